@@ -0,0 +1,113 @@
+#include <Eigen/Core>
+#include <cmath>
+#include <string>
+
+#include "Fixtures.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/Parallel.hpp"
+
+namespace precice {
+namespace bench {
+
+MeshID nextMeshID()
+{
+  static MeshID id = 0;
+  return id++;
+}
+
+mesh::PtrMesh makePlanarMesh(const std::string &name, int n, double z, bool connectivity)
+{
+  auto         mesh = std::make_shared<mesh::Mesh>(name, 3, nextMeshID());
+  const double h    = 1.0 / (n - 1);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      mesh->createVertex(Eigen::Vector3d(i * h, j * h, z));
+    }
+  }
+
+  if (connectivity) {
+    auto &vertices = mesh->vertices();
+    auto  vertex   = [&](int i, int j) -> mesh::Vertex & { return vertices[j * n + i]; };
+    for (int j = 0; j + 1 < n; ++j) {
+      for (int i = 0; i + 1 < n; ++i) {
+        mesh->createTriangle(vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1));
+        mesh->createTriangle(vertex(i, j), vertex(i + 1, j + 1), vertex(i, j + 1));
+      }
+    }
+  }
+  // Serial meshes hold all vertices
+  mesh->setGlobalNumberOfVertices(mesh->vertices().size());
+  return mesh;
+}
+
+mesh::PtrMesh makeVolumeMesh(const std::string &name, int n)
+{
+  auto         mesh = std::make_shared<mesh::Mesh>(name, 3, nextMeshID());
+  const double h    = 1.0 / (n - 1);
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        mesh->createVertex(Eigen::Vector3d(i * h, j * h, k * h));
+      }
+    }
+  }
+
+  auto &vertices = mesh->vertices();
+  auto  vertex   = [&](int i, int j, int k) -> mesh::Vertex & { return vertices[(k * n + j) * n + i]; };
+  for (int k = 0; k + 1 < n; ++k) {
+    for (int j = 0; j + 1 < n; ++j) {
+      for (int i = 0; i + 1 < n; ++i) {
+        // Kuhn triangulation: six tetrahedra sharing the main diagonal of the cell
+        auto &v000 = vertex(i, j, k);
+        auto &v111 = vertex(i + 1, j + 1, k + 1);
+        mesh->createTetrahedron(v000, vertex(i + 1, j, k), vertex(i + 1, j + 1, k), v111);
+        mesh->createTetrahedron(v000, vertex(i + 1, j, k), vertex(i + 1, j, k + 1), v111);
+        mesh->createTetrahedron(v000, vertex(i, j + 1, k), vertex(i + 1, j + 1, k), v111);
+        mesh->createTetrahedron(v000, vertex(i, j + 1, k), vertex(i, j + 1, k + 1), v111);
+        mesh->createTetrahedron(v000, vertex(i, j, k + 1), vertex(i + 1, j, k + 1), v111);
+        mesh->createTetrahedron(v000, vertex(i, j, k + 1), vertex(i, j + 1, k + 1), v111);
+      }
+    }
+  }
+  // Serial meshes hold all vertices
+  mesh->setGlobalNumberOfVertices(mesh->vertices().size());
+  return mesh;
+}
+
+mesh::PtrData addData(mesh::Mesh &mesh, const std::string &name, int dimensions, bool gradient)
+{
+  auto data = mesh.createData(name, dimensions, mesh.data().size());
+  if (gradient) {
+    data->requireDataGradient();
+  }
+  mesh.allocateDataValues();
+
+  auto &values = data->values();
+  for (const auto &vertex : mesh.vertices()) {
+    const auto &coords = vertex.getCoords();
+    for (int d = 0; d < dimensions; ++d) {
+      values(vertex.getID() * dimensions + d) = std::sin(coords(0) + d) * std::cos(coords(1)) + coords(2);
+    }
+  }
+  return data;
+}
+
+bool requireRanks(benchmark::State &state, int size)
+{
+  const int worldSize = utils::Parallel::current()->size();
+  if (worldSize != size) {
+    state.SkipWithError(("This benchmark requires exactly " + std::to_string(size) + " ranks, but runs on " + std::to_string(worldSize) + '.').c_str());
+    return false;
+  }
+  return true;
+}
+
+Rank worldRank()
+{
+  return utils::Parallel::current()->rank();
+}
+
+} // namespace bench
+} // namespace precice
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "mesh/SharedPointer.hpp"
+#include "precice/types.hpp"
+
+namespace precice {
+namespace bench {
+
+/// Returns a new mesh ID, which is unique within this benchmark executable
+MeshID nextMeshID();
+
+/**
+ * @brief Creates a planar grid of n x n vertices spanning the unit square in the x-y plane at height z.
+ *
+ * If connectivity is requested, every grid cell is split into two triangles.
+ */
+mesh::PtrMesh makePlanarMesh(const std::string &name, int n, double z = 0.0, bool connectivity = true);
+
+/// Creates a structured grid of n x n x n vertices in the unit cube, where every cell is split into six tetrahedra
+mesh::PtrMesh makeVolumeMesh(const std::string &name, int n);
+
+/**
+ * @brief Creates data on the given mesh, allocates it and fills it with smooth values based on the vertex coordinates.
+ *
+ * If requested, the data additionally carries (zero-initialized) gradient values.
+ */
+mesh::PtrData addData(mesh::Mesh &mesh, const std::string &name, int dimensions, bool gradient = false);
+
+/**
+ * @brief Checks the size of the world communicator.
+ *
+ * Skips the benchmark with an error if it does not run on exactly the given number of ranks.
+ *
+ * @return true if the benchmark can run.
+ */
+bool requireRanks(benchmark::State &state, int size);
+
+/// Returns the rank of this process in the world communicator
+Rank worldRank();
+
+} // namespace bench
+} // namespace precice
@@ -0,0 +1,57 @@
+#include <Eigen/Core>
+#include <benchmark/benchmark.h>
+
+#include "acceleration/Acceleration.hpp"
+#include "acceleration/impl/QRFactorization.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// Fills a factorization with cols random columns of the given number of rows
+acceleration::impl::QRFactorization makeFactorization(int rows, int cols, int filter)
+{
+  acceleration::impl::QRFactorization qr(filter);
+  qr.setGlobalRows(rows);
+  for (int i = 0; i < cols; ++i) {
+    qr.pushBack(Eigen::VectorXd::Random(rows));
+  }
+  return qr;
+}
+
+} // namespace
+
+/**
+ * Measures the update pattern of the quasi-Newton accelerations:
+ * a new column is inserted at the front and the oldest column is dropped.
+ */
+static void QRFactorizationPushFrontPopBack(benchmark::State &state)
+{
+  const int rows = state.range(0);
+  const int cols = state.range(1);
+  auto      qr   = makeFactorization(rows, cols, acceleration::Acceleration::NOFILTER);
+
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(rows);
+  for (auto _ : state) {
+    qr.pushFront(v);
+    qr.popBack();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(QRFactorizationPushFrontPopBack)->ArgNames({"rows", "cols"})->ArgsProduct({{1000, 10000, 100000}, {10, 50}})->Unit(benchmark::kMicrosecond);
+
+/// Measures the deletion of a column in the middle of the factorization, as triggered by the QR filters
+static void QRFactorizationDeleteInsertColumn(benchmark::State &state)
+{
+  const int rows = state.range(0);
+  const int cols = state.range(1);
+  auto      qr   = makeFactorization(rows, cols, acceleration::Acceleration::NOFILTER);
+
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(rows);
+  for (auto _ : state) {
+    qr.deleteColumn(cols / 2);
+    qr.insertColumn(cols / 2, v);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(QRFactorizationDeleteInsertColumn)->ArgNames({"rows", "cols"})->ArgsProduct({{1000, 10000, 100000}, {10, 50}})->Unit(benchmark::kMicrosecond);
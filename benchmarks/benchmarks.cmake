@@ -0,0 +1,14 @@
+#
+# This file lists all benchmark sources that will be compiled into the benchmark executable
+#
+target_sources(precice-bench
+    PRIVATE
+    benchmarks/Fixtures.cpp
+    benchmarks/Fixtures.hpp
+    benchmarks/acceleration/QRFactorizationBenchmark.cpp
+    benchmarks/com/CommunicateMeshBenchmark.cpp
+    benchmarks/m2n/PointToPointCommunicationBenchmark.cpp
+    benchmarks/mapping/MappingBenchmark.cpp
+    benchmarks/query/IndexBenchmark.cpp
+    benchmarks/time/WaveformBenchmark.cpp
+    )
@@ -0,0 +1,91 @@
+#ifndef PRECICE_NO_MPI
+
+#include <benchmark/benchmark.h>
+#include <memory>
+
+#include "Fixtures.hpp"
+#include "com/CommunicateMesh.hpp"
+#include "com/Communication.hpp"
+#include "com/MPIDirectCommunication.hpp"
+#include "com/SharedPointer.hpp"
+#include "com/SocketCommunication.hpp"
+#include "mesh/Mesh.hpp"
+
+using namespace precice;
+
+namespace {
+
+enum class Backend {
+  MPI,
+  Sockets
+};
+
+/// A connected communication of both ranks together with the rank of the peer
+struct Connection {
+  com::PtrCommunication communication;
+  Rank                  peer;
+};
+
+/**
+ * @brief Connects rank 0 and rank 1 of the world communicator.
+ *
+ * MPI direct communication addresses the peer by its world rank,
+ * whereas both ranks act as serial participants for sockets.
+ */
+Connection connectRanks(Backend backend)
+{
+  const Rank rank = bench::worldRank();
+  if (backend == Backend::MPI) {
+    auto communication = std::make_shared<com::MPIDirectCommunication>();
+    communication->connectIntraComm("Bench", "", rank, 2);
+    return {communication, 1 - rank};
+  }
+
+  auto communication = std::make_shared<com::SocketCommunication>();
+  if (rank == 0) {
+    communication->acceptConnection("BenchA", "BenchB", "", 0);
+  } else {
+    communication->requestConnection("BenchA", "BenchB", "", 0, 1);
+  }
+  return {communication, 0};
+}
+
+/// Rank 0 sends a triangulated planar mesh of n x n vertices to rank 1
+void CommunicateMeshSendReceive(benchmark::State &state, Backend backend)
+{
+  if (!bench::requireRanks(state, 2)) {
+    return;
+  }
+
+  const int n        = state.range(0);
+  auto      sendMesh = bench::makePlanarMesh("Mesh", n);
+
+  Connection           connection = connectRanks(backend);
+  com::CommunicateMesh comMesh(connection.communication);
+
+  // Rank 0 reports the full transfer time, as it waits for an acknowledgement of the reception
+  std::unique_ptr<mesh::Mesh> receiveMesh;
+  for (auto _ : state) {
+    if (bench::worldRank() == 0) {
+      comMesh.sendMesh(*sendMesh, connection.peer);
+      int ack = 0;
+      connection.communication->receive(ack, connection.peer);
+    } else {
+      state.PauseTiming();
+      receiveMesh = std::make_unique<mesh::Mesh>("Mesh", 3, bench::nextMeshID());
+      state.ResumeTiming();
+      comMesh.receiveMesh(*receiveMesh, connection.peer);
+      connection.communication->send(1, connection.peer);
+    }
+  }
+  state.counters["vertices"]  = sendMesh->vertices().size();
+  state.counters["triangles"] = sendMesh->triangles().size();
+}
+
+} // namespace
+
+// Both ranks need to run in lockstep, hence a fixed number of iterations
+BENCHMARK_CAPTURE(CommunicateMeshSendReceive, MPI, Backend::MPI)->Name("TwoRanks/CommunicateMesh/MPI")->RangeMultiplier(4)->Range(16, 256)->Iterations(20)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CommunicateMeshSendReceive, Sockets, Backend::Sockets)->Name("TwoRanks/CommunicateMesh/Sockets")->RangeMultiplier(4)->Range(16, 256)->Iterations(20)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,70 @@
+#ifndef PRECICE_NO_MPI
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "Fixtures.hpp"
+#include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+#include "com/SocketCommunicationFactory.hpp"
+#include "m2n/PointToPointCommunication.hpp"
+#include "mesh/Mesh.hpp"
+
+using namespace precice;
+
+namespace {
+
+/**
+ * Rank 0 acts as participant A and rank 1 as participant B, both running serially.
+ * A sends vector data of n vertices to B, which sends it back.
+ */
+void PointToPointCommunicationRoundTrip(benchmark::State &state, com::PtrCommunicationFactory factory)
+{
+  if (!bench::requireRanks(state, 2)) {
+    return;
+  }
+
+  const int n              = state.range(0);
+  const int valueDimension = 3;
+
+  auto mesh = std::make_shared<mesh::Mesh>("Mesh", 3, bench::nextMeshID());
+  mesh->setGlobalNumberOfVertices(n);
+  std::vector<int> globalIndices(n);
+  std::iota(globalIndices.begin(), globalIndices.end(), 0);
+  mesh->setVertexDistribution({{0, globalIndices}});
+
+  m2n::PointToPointCommunication communication(factory, mesh);
+  std::vector<double>            data(n * valueDimension, 1.0);
+
+  const bool isA = bench::worldRank() == 0;
+  if (isA) {
+    communication.requestConnection("B", "A");
+  } else {
+    communication.acceptConnection("B", "A");
+  }
+
+  for (auto _ : state) {
+    if (isA) {
+      communication.send(data, valueDimension);
+      communication.receive(data, valueDimension);
+    } else {
+      communication.receive(data, valueDimension);
+      communication.send(data, valueDimension);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * data.size() * sizeof(double));
+}
+
+} // namespace
+
+// Both ranks need to run in lockstep, hence a fixed number of iterations
+BENCHMARK_CAPTURE(PointToPointCommunicationRoundTrip, Sockets, std::make_shared<com::SocketCommunicationFactory>())->Name("TwoRanks/PointToPointCommunication/Sockets")->RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Iterations(50)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+// OpenMPI requires a running ompi-server to connect via ports, which is also why the corresponding tests are disabled.
+#ifndef PRECICE_BENCH_NO_MPI_PORTS
+BENCHMARK_CAPTURE(PointToPointCommunicationRoundTrip, MPIPorts, std::make_shared<com::MPIPortsCommunicationFactory>())->Name("TwoRanks/PointToPointCommunication/MPIPorts")->RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Iterations(50)->UseRealTime()->Unit(benchmark::kMicrosecond);
+#endif
+
+#endif // PRECICE_NO_MPI
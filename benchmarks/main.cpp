@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "logging/LogConfiguration.hpp"
+#include "utils/EventUtils.hpp"
+#include "utils/IntraComm.hpp"
+#include "utils/Parallel.hpp"
+
+namespace {
+
+/// Reporter which discards all output, used on all ranks but rank 0
+class NullReporter : public benchmark::BenchmarkReporter {
+public:
+  bool ReportContext(const Context &) override
+  {
+    return true;
+  }
+  void ReportRuns(const std::vector<Run> &) override {}
+  void Finalize() override {}
+};
+
+/// Returns true if any of the arguments starts with the given prefix
+bool hasArgument(int argc, char **argv, const std::string &prefix)
+{
+  for (int i = 1; i < argc; ++i) {
+    if (std::string(argv[i]).rfind(prefix, 0) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+/**
+ * Entry point of the benchmark executable
+ *
+ * Run serially, it executes all benchmarks of single components.
+ * Run on two ranks, it executes all benchmarks whose name starts with "TwoRanks/",
+ * where rank 0 and rank 1 communicate with each other.
+ * Only rank 0 reports results. All options of Google Benchmark are supported,
+ * use --benchmark_out=<file> --benchmark_out_format=json for machine-readable results.
+ */
+int main(int argc, char **argv)
+{
+  using namespace precice;
+
+  // Only report warnings and errors of preCICE, as regular output would interfere with the results
+  logging::BackendConfiguration logConfig;
+  logConfig.filter = "%Severity% >= warning";
+  logging::setupLogging({logConfig});
+
+  utils::Parallel::initializeMPI(&argc, &argv);
+  const auto rank = utils::Parallel::current()->rank();
+  const auto size = utils::Parallel::current()->size();
+  logging::setMPIRank(rank);
+
+  utils::IntraComm::configure(0, 1);
+  utils::EventRegistry::instance().initialize("precice-bench", "", utils::Parallel::current()->comm);
+
+  const bool hasFilter = hasArgument(argc, argv, "--benchmark_filter");
+
+  // Only rank 0 writes the output file, hence the other ranks drop the corresponding options
+  std::vector<char *> args(argv, argv + argc);
+  if (rank != 0) {
+    args.erase(std::remove_if(args.begin() + 1, args.end(), [](char *arg) { return std::string(arg).rfind("--benchmark_out", 0) == 0; }), args.end());
+  }
+  int argsCount = args.size();
+
+  benchmark::Initialize(&argsCount, args.data());
+  if (benchmark::ReportUnrecognizedArguments(argsCount, args.data())) {
+    utils::Parallel::finalizeMPI();
+    return 1;
+  }
+
+  if (!hasFilter) {
+    if (size == 1) {
+      benchmark::SetBenchmarkFilter("-^TwoRanks/");
+    } else if (size == 2) {
+      benchmark::SetBenchmarkFilter("^TwoRanks/");
+    } else {
+      if (rank == 0) {
+        std::cerr << "ERROR: The benchmarks run either serially or on 2 ranks, but this run uses " << size << " ranks.\n";
+      }
+      utils::Parallel::finalizeMPI();
+      return 2;
+    }
+  }
+
+  if (rank == 0) {
+    benchmark::RunSpecifiedBenchmarks();
+  } else {
+    NullReporter nullReporter;
+    benchmark::RunSpecifiedBenchmarks(&nullReporter);
+  }
+  benchmark::Shutdown();
+
+  utils::EventRegistry::instance().finalize();
+  utils::IntraComm::getCommunication() = nullptr;
+  utils::Parallel::finalizeMPI();
+  return 0;
+}
@@ -0,0 +1,140 @@
+#include <array>
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+
+#include "Fixtures.hpp"
+#include "mapping/LinearCellInterpolationMapping.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/NearestNeighborGradientMapping.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "query/Index.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// Creates a mapping for meshes with a grid spacing of 1/(n-1)
+using MappingFactory = std::function<std::unique_ptr<mapping::Mapping>(int n)>;
+
+/// Geometric setup of the benchmarked mapping
+enum class Setup {
+  /// Triangulated planar input mesh, non-matching planar output mesh of (n+1)^2 vertices
+  Surface,
+  /// Tetrahedral input mesh, planar output mesh of (n+1)^2 vertices cutting through the volume
+  Volume
+};
+
+/// Holds the meshes and data of a benchmarked mapping
+struct MappingSetup {
+  MappingSetup(Setup setup, int n, bool gradient)
+  {
+    input = (setup == Setup::Surface) ? bench::makePlanarMesh("Input", n) : bench::makeVolumeMesh("Input", n);
+    // The output mesh is a finer, non-matching grid
+    output     = bench::makePlanarMesh("Output", n + 1, (setup == Setup::Surface) ? 0.0 : 0.5, false);
+    inputData  = bench::addData(*input, "Data", 1, gradient);
+    outputData = bench::addData(*output, "Data", 1);
+  }
+
+  mesh::PtrMesh input;
+  mesh::PtrMesh output;
+  mesh::PtrData inputData;
+  mesh::PtrData outputData;
+};
+
+const auto consistent = mapping::Mapping::CONSISTENT;
+
+/// Planar meshes are located in the x-y plane, hence the z-axis is dead for RBF mappings
+const std::array<bool, 3> zDead{{false, false, true}};
+
+std::unique_ptr<mapping::Mapping> nearestNeighbor(int)
+{
+  return std::make_unique<mapping::NearestNeighborMapping>(consistent, 3);
+}
+
+std::unique_ptr<mapping::Mapping> nearestNeighborGradient(int)
+{
+  return std::make_unique<mapping::NearestNeighborGradientMapping>(consistent, 3);
+}
+
+std::unique_ptr<mapping::Mapping> nearestProjection(int)
+{
+  return std::make_unique<mapping::NearestProjectionMapping>(consistent, 3);
+}
+
+std::unique_ptr<mapping::Mapping> linearCellInterpolation(int)
+{
+  return std::make_unique<mapping::LinearCellInterpolationMapping>(consistent, 3);
+}
+
+std::unique_ptr<mapping::Mapping> rbfCompactPolynomialC2(int n)
+{
+  mapping::CompactPolynomialC2 function(3.0 / (n - 1));
+  return std::make_unique<mapping::RadialBasisFctMapping<mapping::CompactPolynomialC2>>(consistent, 3, function, zDead, mapping::Polynomial::SEPARATE);
+}
+
+std::unique_ptr<mapping::Mapping> rbfThinPlateSplines(int)
+{
+  return std::make_unique<mapping::RadialBasisFctMapping<mapping::ThinPlateSplines>>(consistent, 3, mapping::ThinPlateSplines(), zDead, mapping::Polynomial::SEPARATE);
+}
+
+/// Measures computeMapping() including the construction of the required index trees
+void MappingComputeMapping(benchmark::State &state, Setup setup, MappingFactory create, bool gradient)
+{
+  MappingSetup meshes(setup, state.range(0), gradient);
+  auto         mapping = create(state.range(0));
+  mapping->setMeshes(meshes.input, meshes.output);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    mapping->clear();
+    meshes.input->index().clear();
+    meshes.output->index().clear();
+    state.ResumeTiming();
+
+    mapping->computeMapping();
+  }
+  state.counters["vertices"] = meshes.input->vertices().size() + meshes.output->vertices().size();
+}
+
+/// Measures map() of scalar data on a precomputed mapping
+void MappingMap(benchmark::State &state, Setup setup, MappingFactory create, bool gradient)
+{
+  MappingSetup meshes(setup, state.range(0), gradient);
+  auto         mapping = create(state.range(0));
+  mapping->setMeshes(meshes.input, meshes.output);
+  mapping->computeMapping();
+
+  for (auto _ : state) {
+    mapping->map(meshes.inputData->getID(), meshes.outputData->getID());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * meshes.output->vertices().size());
+}
+
+} // namespace
+
+// Cheap mappings scale to large meshes
+BENCHMARK_CAPTURE(MappingComputeMapping, NearestNeighbor, Setup::Surface, nearestNeighbor, false)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MappingMap, NearestNeighbor, Setup::Surface, nearestNeighbor, false)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(MappingComputeMapping, NearestNeighborGradient, Setup::Surface, nearestNeighborGradient, true)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MappingMap, NearestNeighborGradient, Setup::Surface, nearestNeighborGradient, true)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(MappingComputeMapping, NearestProjection, Setup::Surface, nearestProjection, false)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MappingMap, NearestProjection, Setup::Surface, nearestProjection, false)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(MappingComputeMapping, LinearCellInterpolation, Setup::Volume, linearCellInterpolation, false)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MappingMap, LinearCellInterpolation, Setup::Volume, linearCellInterpolation, false)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMicrosecond);
+
+// The Eigen-based RBF mappings assemble and factorize dense systems, which limits the mesh sizes
+BENCHMARK_CAPTURE(MappingComputeMapping, RBFCompactPolynomialC2, Setup::Surface, rbfCompactPolynomialC2, false)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MappingMap, RBFCompactPolynomialC2, Setup::Surface, rbfCompactPolynomialC2, false)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(MappingComputeMapping, RBFThinPlateSplines, Setup::Surface, rbfThinPlateSplines, false)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MappingMap, RBFThinPlateSplines, Setup::Surface, rbfThinPlateSplines, false)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMicrosecond);
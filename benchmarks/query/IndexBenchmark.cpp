@@ -0,0 +1,127 @@
+#include <Eigen/Core>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "Fixtures.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// Query locations slightly above a planar mesh, on a grid that does not match the mesh
+std::vector<Eigen::VectorXd> queryLocations(int n)
+{
+  std::vector<Eigen::VectorXd> locations;
+  locations.reserve(n * n);
+  const double h = 1.0 / n;
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      locations.emplace_back(Eigen::Vector3d((i + 0.5) * h, (j + 0.5) * h, 0.01));
+    }
+  }
+  return locations;
+}
+
+} // namespace
+
+/// Builds the vertex tree from scratch, which is dominated by the construction of the tree
+static void IndexBuildVertexTree(benchmark::State &state)
+{
+  const int  n    = state.range(0);
+  auto       mesh = bench::makePlanarMesh("Mesh", n, 0.0, false);
+  const auto probe{Eigen::Vector3d(0.5, 0.5, 0.5)};
+
+  for (auto _ : state) {
+    query::Index index(mesh);
+    benchmark::DoNotOptimize(index.getClosestVertex(probe));
+  }
+  state.SetItemsProcessed(state.iterations() * mesh->vertices().size());
+}
+BENCHMARK(IndexBuildVertexTree)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+
+/// Builds the triangle tree from scratch, which is dominated by the construction of the tree
+static void IndexBuildTriangleTree(benchmark::State &state)
+{
+  const int  n    = state.range(0);
+  auto       mesh = bench::makePlanarMesh("Mesh", n);
+  const auto probe{Eigen::Vector3d(0.5, 0.5, 0.5)};
+
+  for (auto _ : state) {
+    query::Index index(mesh);
+    benchmark::DoNotOptimize(index.getClosestTriangles(probe, 1));
+  }
+  state.SetItemsProcessed(state.iterations() * mesh->triangles().size());
+}
+BENCHMARK(IndexBuildTriangleTree)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+
+static void IndexGetClosestVertex(benchmark::State &state)
+{
+  const int n         = state.range(0);
+  auto      mesh      = bench::makePlanarMesh("Mesh", n, 0.0, false);
+  auto      locations = queryLocations(n);
+
+  query::Index index(mesh);
+  for (auto _ : state) {
+    for (const auto &location : locations) {
+      benchmark::DoNotOptimize(index.getClosestVertex(location));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * locations.size());
+}
+BENCHMARK(IndexGetClosestVertex)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+
+static void IndexGetVerticesInsideBox(benchmark::State &state)
+{
+  const int    n      = state.range(0);
+  auto         mesh   = bench::makePlanarMesh("Mesh", n, 0.0, false);
+  const double radius = 3.0 / n;
+
+  query::Index index(mesh);
+  for (auto _ : state) {
+    for (const auto &vertex : mesh->vertices()) {
+      benchmark::DoNotOptimize(index.getVerticesInsideBox(vertex, radius));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mesh->vertices().size());
+}
+BENCHMARK(IndexGetVerticesInsideBox)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+
+static void IndexFindNearestProjection(benchmark::State &state)
+{
+  const int n         = state.range(0);
+  auto      mesh      = bench::makePlanarMesh("Mesh", n);
+  auto      locations = queryLocations(n);
+
+  query::Index index(mesh);
+  for (auto _ : state) {
+    for (const auto &location : locations) {
+      benchmark::DoNotOptimize(index.findNearestProjection(location, 4));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * locations.size());
+}
+BENCHMARK(IndexFindNearestProjection)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+
+static void IndexGetEnclosingTetrahedra(benchmark::State &state)
+{
+  const int n    = state.range(0);
+  auto      mesh = bench::makeVolumeMesh("Mesh", n);
+
+  std::vector<Eigen::VectorXd> locations;
+  const double                 h = 1.0 / n;
+  for (int i = 0; i < n; ++i) {
+    locations.emplace_back(Eigen::Vector3d::Constant((i + 0.5) * h));
+  }
+
+  query::Index index(mesh);
+  for (auto _ : state) {
+    for (const auto &location : locations) {
+      benchmark::DoNotOptimize(index.getEnclosingTetrahedra(location));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * locations.size());
+}
+BENCHMARK(IndexGetEnclosingTetrahedra)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMicrosecond);
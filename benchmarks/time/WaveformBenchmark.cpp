@@ -0,0 +1,54 @@
+#include <Eigen/Core>
+#include <benchmark/benchmark.h>
+
+#include "time/Waveform.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// Creates a waveform of the given order, which holds enough windows to use the full order
+time::Waveform makeWaveform(int order, int size)
+{
+  time::Waveform waveform(order);
+  waveform.initialize(Eigen::VectorXd::Zero(size));
+  for (int window = 0; window < order; ++window) {
+    waveform.store(Eigen::VectorXd::Constant(size, window + 1));
+    waveform.moveToNextWindow();
+  }
+  waveform.store(Eigen::VectorXd::Random(size));
+  return waveform;
+}
+
+} // namespace
+
+static void WaveformSample(benchmark::State &state)
+{
+  const int order = state.range(0);
+  const int size  = state.range(1);
+  auto      waveform{makeWaveform(order, size)};
+
+  for (auto _ : state) {
+    for (double dt : {0.25, 0.5, 0.75, 1.0}) {
+      benchmark::DoNotOptimize(waveform.sample(dt));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(WaveformSample)->ArgNames({"order", "size"})->ArgsProduct({{0, 1, 2}, {1000, 100000}})->Unit(benchmark::kMicrosecond);
+
+/// Measures storing the values of a window and moving to the next one, as done in every time window
+static void WaveformStoreAndMove(benchmark::State &state)
+{
+  const int order = state.range(0);
+  const int size  = state.range(1);
+  auto      waveform{makeWaveform(order, size)};
+
+  const Eigen::VectorXd values = Eigen::VectorXd::Random(size);
+  for (auto _ : state) {
+    waveform.store(values);
+    waveform.moveToNextWindow();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(WaveformStoreAndMove)->ArgNames({"order", "size"})->ArgsProduct({{0, 1, 2}, {1000, 100000}})->Unit(benchmark::kMicrosecond);
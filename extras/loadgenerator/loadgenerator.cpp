@@ -0,0 +1,468 @@
+#include <mpi.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "precice/SolverInterface.hpp"
+
+namespace {
+
+/// Command line options of the form --key=value or --flag
+class Options {
+public:
+  Options(int argc, char **argv)
+  {
+    for (int i = 2; i < argc; ++i) {
+      std::string arg(argv[i]);
+      if (arg.rfind("--", 0) != 0) {
+        throw std::runtime_error("Unexpected argument \"" + arg + "\"");
+      }
+      const auto separator = arg.find('=');
+      if (separator == std::string::npos) {
+        _values[arg.substr(2)] = "true";
+      } else {
+        _values[arg.substr(2, separator - 2)] = arg.substr(separator + 1);
+      }
+    }
+  }
+
+  std::string get(const std::string &key, const std::string &fallback)
+  {
+    _used.push_back(key);
+    auto it = _values.find(key);
+    return it == _values.end() ? fallback : it->second;
+  }
+
+  int get(const std::string &key, int fallback)
+  {
+    return std::stoi(get(key, std::to_string(fallback)));
+  }
+
+  double get(const std::string &key, double fallback)
+  {
+    return std::stod(get(key, std::to_string(fallback)));
+  }
+
+  bool has(const std::string &key)
+  {
+    return get(key, "false") == "true";
+  }
+
+  /// Throws if options were given which have not been queried
+  void checkUnused() const
+  {
+    for (const auto &kv : _values) {
+      if (std::find(_used.begin(), _used.end(), kv.first) == _used.end()) {
+        throw std::runtime_error("Unknown option \"--" + kv.first + "\"");
+      }
+    }
+  }
+
+private:
+  std::map<std::string, std::string> _values;
+  std::vector<std::string>           _used;
+};
+
+void printUsage()
+{
+  std::cout << "Synthetic two-participant load generator for preCICE\n\n"
+               "Usage:\n"
+               "  loadgenerator config [options] > precice-config.xml\n"
+               "  mpirun -np N loadgenerator run --participant=A [options] &\n"
+               "  mpirun -np M loadgenerator run --participant=B [options]\n\n"
+               "Options of \"config\":\n"
+               "  --dimensions=3               Dimensions of the coupling (2 or 3)\n"
+               "  --scheme=serial-implicit     serial-explicit, parallel-explicit, serial-implicit, or parallel-implicit\n"
+               "  --windows=10                 Number of time windows\n"
+               "  --iterations=3               Number of iterations per time window of implicit schemes\n"
+               "  --acceleration=none          Acceleration of implicit schemes: none, aitken, IQN-ILS, or IQN-IMVJ\n"
+               "  --mapping=nearest-neighbor   Mapping used by participant B, e.g. nearest-projection or rbf-compact-polynomial-c2\n"
+               "  --mapping-attributes=        Additional attributes of the mapping tag, e.g. support-radius=\"0.1\"\n"
+               "  --m2n=sockets                Communication back-end: sockets, mpi, or mpi-single\n"
+               "  --two-level-initialization   Use the two-level initialization of the communication\n\n"
+               "Options of \"run\":\n"
+               "  --participant=A              Participant to run: A or B\n"
+               "  --config=precice-config.xml  Configuration file created by \"config\"\n"
+               "  --shape=planar               Interface mesh: planar, shell (curved surface), or volume\n"
+               "  --vertices=10000             Approximate global number of vertices\n"
+               "  --partition-axis=0           Axis along which the mesh is partitioned among the ranks.\n"
+               "                               Use different axes for A and B to obtain non-matching partitions\n"
+               "  --connectivity               Define edges, triangles, or tetrahedra within each partition,\n"
+               "                               even if the configuration does not require connectivity\n"
+               "  --solver-time=0              Time in milliseconds the solver sleeps in every time step\n";
+}
+
+/// Generates a preCICE configuration of participant A providing MeshA and participant B mapping to and from MeshA
+std::string generateConfiguration(Options &options)
+{
+  const int         dimensions   = options.get("dimensions", 3);
+  const std::string scheme       = options.get("scheme", std::string("serial-implicit"));
+  const int         windows      = options.get("windows", 10);
+  const int         iterations   = options.get("iterations", 3);
+  const std::string acceleration = options.get("acceleration", std::string("none"));
+  const std::string mapping      = options.get("mapping", std::string("nearest-neighbor"));
+  const std::string attributes   = options.get("mapping-attributes", std::string(""));
+  const std::string m2n          = options.get("m2n", std::string("sockets"));
+  const bool        twoLevel     = options.has("two-level-initialization");
+  options.checkUnused();
+
+  const bool implicit = scheme.find("implicit") != std::string::npos;
+  const bool parallel = scheme.find("parallel") != std::string::npos;
+
+  std::ostringstream os;
+  os << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+     << "<precice-configuration>\n"
+     << "  <log>\n"
+     << "    <sink filter=\"%Severity% > info\" enabled=\"true\" />\n"
+     << "  </log>\n\n"
+     << "  <solver-interface dimensions=\"" << dimensions << "\">\n"
+     << "    <data:vector name=\"DataA\" />\n"
+     << "    <data:vector name=\"DataB\" />\n\n"
+     << "    <mesh name=\"MeshA\">\n"
+     << "      <use-data name=\"DataA\" />\n"
+     << "      <use-data name=\"DataB\" />\n"
+     << "    </mesh>\n\n"
+     << "    <mesh name=\"MeshB\">\n"
+     << "      <use-data name=\"DataA\" />\n"
+     << "      <use-data name=\"DataB\" />\n"
+     << "    </mesh>\n\n"
+     << "    <participant name=\"A\">\n"
+     << "      <use-mesh name=\"MeshA\" provide=\"yes\" />\n"
+     << "      <write-data name=\"DataA\" mesh=\"MeshA\" />\n"
+     << "      <read-data name=\"DataB\" mesh=\"MeshA\" />\n"
+     << "    </participant>\n\n"
+     << "    <participant name=\"B\">\n"
+     << "      <use-mesh name=\"MeshA\" from=\"A\" />\n"
+     << "      <use-mesh name=\"MeshB\" provide=\"yes\" />\n"
+     << "      <mapping:" << mapping << " direction=\"write\" from=\"MeshB\" to=\"MeshA\" constraint=\"conservative\" " << attributes << " />\n"
+     << "      <mapping:" << mapping << " direction=\"read\" from=\"MeshA\" to=\"MeshB\" constraint=\"consistent\" " << attributes << " />\n"
+     << "      <write-data name=\"DataB\" mesh=\"MeshB\" />\n"
+     << "      <read-data name=\"DataA\" mesh=\"MeshB\" />\n"
+     << "    </participant>\n\n"
+     << "    <m2n:" << m2n << " from=\"A\" to=\"B\"" << (twoLevel ? " use-two-level-initialization=\"true\"" : "") << " />\n\n"
+     << "    <coupling-scheme:" << scheme << ">\n"
+     << "      <participants first=\"A\" second=\"B\" />\n"
+     << "      <max-time-windows value=\"" << windows << "\" />\n"
+     << "      <time-window-size value=\"1.0\" />\n"
+     << "      <exchange data=\"DataA\" mesh=\"MeshA\" from=\"A\" to=\"B\" />\n"
+     << "      <exchange data=\"DataB\" mesh=\"MeshA\" from=\"B\" to=\"A\" />\n";
+  if (implicit) {
+    // Enforces exactly the given number of iterations in every window
+    os << "      <max-iterations value=\"" << iterations << "\" />\n"
+       << "      <min-iteration-convergence-measure min-iterations=\"" << iterations << "\" data=\"DataB\" mesh=\"MeshA\" />\n";
+    if (acceleration != "none") {
+      os << "      <acceleration:" << acceleration << ">\n"
+         << "        <initial-relaxation value=\"0.5\" />\n";
+      if (acceleration != "aitken") {
+        os << "        <max-used-iterations value=\"50\" />\n"
+           << "        <time-windows-reused value=\"5\" />\n"
+           << "        <preconditioner type=\"residual-sum\" />\n";
+      }
+      if (parallel) {
+        os << "        <data name=\"DataA\" mesh=\"MeshA\" />\n";
+      }
+      os << "        <data name=\"DataB\" mesh=\"MeshA\" />\n"
+         << "      </acceleration:" << acceleration << ">\n";
+    }
+  }
+  os << "    </coupling-scheme:" << scheme << ">\n"
+     << "  </solver-interface>\n"
+     << "</precice-configuration>\n";
+  return os.str();
+}
+
+/// A structured grid of vertices, of which every rank holds a slab along the partition axis
+class Grid {
+public:
+  Grid(const std::string &shape, int dimensions, int vertices, int partitionAxis, int rank, int size)
+      : _shape(shape), _dimensions(dimensions)
+  {
+    // Surfaces have one dimension less than the coupling
+    const int  gridDimensions = (shape == "volume") ? dimensions : dimensions - 1;
+    const auto perAxis        = std::max(2, static_cast<int>(std::round(std::pow(vertices, 1.0 / gridDimensions))));
+    for (int axis = 0; axis < gridDimensions; ++axis) {
+      _size[axis] = perAxis;
+    }
+    if (partitionAxis >= gridDimensions) {
+      throw std::runtime_error("The partition axis has to be smaller than " + std::to_string(gridDimensions) + " for this shape");
+    }
+    if (_size[partitionAxis] < size) {
+      throw std::runtime_error("There are less vertex layers than ranks, please increase the number of vertices");
+    }
+
+    _begin                = {0, 0, 0};
+    _end                  = _size;
+    _begin[partitionAxis] = rank * _size[partitionAxis] / size;
+    _end[partitionAxis]   = (rank + 1) * _size[partitionAxis] / size;
+  }
+
+  /// Returns the coordinates of all local vertices
+  std::vector<double> coordinates() const
+  {
+    std::vector<double> coords;
+    forEachLocal([&](int i, int j, int k) {
+      const auto position = coordinate(i, j, k);
+      coords.insert(coords.end(), position.begin(), position.begin() + _dimensions);
+    });
+    return coords;
+  }
+
+  int localSize() const
+  {
+    return (_end[0] - _begin[0]) * (_end[1] - _begin[1]) * (_end[2] - _begin[2]);
+  }
+
+  /// Defines edges, triangles, or tetrahedra of all cells within the local partition
+  void defineConnectivity(precice::SolverInterface &interface, int meshID, const std::vector<int> &ids) const
+  {
+    auto id = [&](int i, int j, int k) {
+      return ids[((k - _begin[2]) * (_end[1] - _begin[1]) + (j - _begin[1])) * (_end[0] - _begin[0]) + (i - _begin[0])];
+    };
+    const bool volume = (_shape == "volume");
+
+    if (_size[1] == 1) {
+      // Lines
+      for (int i = _begin[0]; i + 1 < _end[0]; ++i) {
+        interface.setMeshEdge(meshID, id(i, 0, 0), id(i + 1, 0, 0));
+      }
+    } else if (_size[2] == 1 || !volume) {
+      // Surfaces in 3D or volumes in 2D
+      for (int j = _begin[1]; j + 1 < _end[1]; ++j) {
+        for (int i = _begin[0]; i + 1 < _end[0]; ++i) {
+          interface.setMeshTriangleWithEdges(meshID, id(i, j, 0), id(i + 1, j, 0), id(i + 1, j + 1, 0));
+          interface.setMeshTriangleWithEdges(meshID, id(i, j, 0), id(i + 1, j + 1, 0), id(i, j + 1, 0));
+        }
+      }
+    } else {
+      // Kuhn triangulation of every cell into six tetrahedra
+      for (int k = _begin[2]; k + 1 < _end[2]; ++k) {
+        for (int j = _begin[1]; j + 1 < _end[1]; ++j) {
+          for (int i = _begin[0]; i + 1 < _end[0]; ++i) {
+            const int v000 = id(i, j, k);
+            const int v111 = id(i + 1, j + 1, k + 1);
+            interface.setMeshTetrahedron(meshID, v000, id(i + 1, j, k), id(i + 1, j + 1, k), v111);
+            interface.setMeshTetrahedron(meshID, v000, id(i + 1, j, k), id(i + 1, j, k + 1), v111);
+            interface.setMeshTetrahedron(meshID, v000, id(i, j + 1, k), id(i + 1, j + 1, k), v111);
+            interface.setMeshTetrahedron(meshID, v000, id(i, j + 1, k), id(i, j + 1, k + 1), v111);
+            interface.setMeshTetrahedron(meshID, v000, id(i, j, k + 1), id(i + 1, j, k + 1), v111);
+            interface.setMeshTetrahedron(meshID, v000, id(i, j, k + 1), id(i, j + 1, k + 1), v111);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  template <typename FUNC>
+  void forEachLocal(FUNC f) const
+  {
+    for (int k = _begin[2]; k < _end[2]; ++k) {
+      for (int j = _begin[1]; j < _end[1]; ++j) {
+        for (int i = _begin[0]; i < _end[0]; ++i) {
+          f(i, j, k);
+        }
+      }
+    }
+  }
+
+  /// Maps grid indices to the unit square or cube, or to a quarter of a cylinder for shells
+  std::array<double, 3> coordinate(int i, int j, int k) const
+  {
+    const double u = static_cast<double>(i) / std::max(1, _size[0] - 1);
+    const double v = static_cast<double>(j) / std::max(1, _size[1] - 1);
+    const double w = static_cast<double>(k) / std::max(1, _size[2] - 1);
+    if (_shape == "shell") {
+      const double angle = u * M_PI / 2;
+      return {std::cos(angle), std::sin(angle), v};
+    }
+    return {u, v, w};
+  }
+
+  std::string        _shape;
+  int                _dimensions;
+  std::array<int, 3> _size{1, 1, 1};
+  std::array<int, 3> _begin;
+  std::array<int, 3> _end;
+};
+
+/// Accumulates wall-clock times of the phases of the solver loop
+class PhaseTimer {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  template <typename FUNC>
+  auto measure(const std::string &phase, FUNC f)
+  {
+    const auto start = Clock::now();
+    struct Stop {
+      ~Stop()
+      {
+        times[phase] += std::chrono::duration<double>(Clock::now() - start).count();
+      }
+      std::map<std::string, double> &times;
+      const std::string &            phase;
+      Clock::time_point              start;
+    } stop{_times, phase, start};
+    return f();
+  }
+
+  /// Prints the maximum time of each phase over all ranks on rank 0
+  void report(MPI_Comm comm, int rank) const
+  {
+    if (rank == 0) {
+      std::cout << "\nLoad generator timings (maximum over ranks)\n";
+    }
+    for (const auto &phase : _times) {
+      double maximum = 0;
+      MPI_Reduce(&phase.second, &maximum, 1, MPI_DOUBLE, MPI_MAX, 0, comm);
+      if (rank == 0) {
+        std::cout << "  " << std::left << std::setw(16) << phase.first << std::right << std::setw(12) << std::fixed << std::setprecision(4) << maximum << " s\n";
+      }
+    }
+  }
+
+private:
+  std::map<std::string, double> _times;
+};
+
+/// Runs one participant of the synthetic coupling
+void run(Options &options, int rank, int size)
+{
+  using namespace precice::constants;
+
+  const std::string participant   = options.get("participant", std::string("A"));
+  const std::string configuration = options.get("config", std::string("precice-config.xml"));
+  const std::string shape         = options.get("shape", std::string("planar"));
+  const int         vertices      = options.get("vertices", 10000);
+  const int         partitionAxis = options.get("partition-axis", 0);
+  const bool        connectivity  = options.has("connectivity");
+  const double      solverTime    = options.get("solver-time", 0.0);
+  options.checkUnused();
+
+  if (participant != "A" && participant != "B") {
+    throw std::runtime_error("The participant has to be either A or B");
+  }
+  const std::string other = (participant == "A") ? "B" : "A";
+
+  PhaseTimer                                timer;
+  std::unique_ptr<precice::SolverInterface> interfacePtr;
+  timer.measure("construct", [&] {
+    interfacePtr = std::make_unique<precice::SolverInterface>(participant, configuration, rank, size);
+  });
+  auto &interface = *interfacePtr;
+
+  const int dimensions = interface.getDimensions();
+  const int meshID     = interface.getMeshID("Mesh" + participant);
+  const int writeID    = interface.getDataID("Data" + participant, meshID);
+  const int readID     = interface.getDataID("Data" + other, meshID);
+
+  Grid             grid(shape, dimensions, vertices, partitionAxis, rank, size);
+  std::vector<int> ids(grid.localSize());
+  auto             coords = grid.coordinates();
+  timer.measure("mesh", [&] {
+    interface.setMeshVertices(meshID, ids.size(), coords.data(), ids.data());
+    if (connectivity || interface.isMeshConnectivityRequired(meshID)) {
+      grid.defineConnectivity(interface, meshID, ids);
+    }
+  });
+
+  std::vector<double> readData(ids.size() * dimensions);
+  std::vector<double> writeData(ids.size() * dimensions);
+
+  double dt = timer.measure("initialize", [&] { return interface.initialize(); });
+
+  int    windows    = 0;
+  int    iterations = 0;
+  double time       = 0;
+  while (interface.isCouplingOngoing()) {
+    if (interface.isActionRequired(actionWriteIterationCheckpoint())) {
+      interface.markActionFulfilled(actionWriteIterationCheckpoint());
+    }
+
+    timer.measure("read", [&] {
+      interface.readBlockVectorData(readID, ids.size(), ids.data(), readData.data());
+    });
+
+    timer.measure("solve", [&] {
+      std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(solverTime));
+      for (std::size_t i = 0; i < writeData.size(); ++i) {
+        writeData[i] = std::sin(coords[i] + time + dt) + 0.1 * readData[i];
+      }
+    });
+
+    timer.measure("write", [&] {
+      interface.writeBlockVectorData(writeID, ids.size(), ids.data(), writeData.data());
+    });
+
+    dt = timer.measure("advance", [&] { return interface.advance(dt); });
+    ++iterations;
+
+    if (interface.isActionRequired(actionReadIterationCheckpoint())) {
+      interface.markActionFulfilled(actionReadIterationCheckpoint());
+    } else {
+      time += dt;
+      ++windows;
+    }
+  }
+
+  timer.measure("finalize", [&] { interface.finalize(); });
+
+  if (rank == 0) {
+    std::cout << "\nParticipant " << participant << " ran " << windows << " time windows with " << iterations << " iterations in total on " << size << " ranks\n";
+  }
+  timer.report(MPI_COMM_WORLD, rank);
+
+  // preCICE writes the timings of its internal events on finalize
+  if (rank == 0) {
+    std::ifstream summary("precice-" + participant + "-events-summary.log");
+    if (summary) {
+      std::cout << "\npreCICE event timings\n"
+                << summary.rdbuf() << '\n';
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  MPI_Init(&argc, &argv);
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  const std::string command = (argc > 1) ? argv[1] : "";
+  int               result  = EXIT_SUCCESS;
+  try {
+    Options options(argc, argv);
+    if (command == "config") {
+      if (rank == 0) {
+        std::cout << generateConfiguration(options);
+      }
+    } else if (command == "run") {
+      run(options, rank, size);
+    } else {
+      if (rank == 0) {
+        printUsage();
+      }
+      result = (command == "help" || command == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "ERROR: " << e.what() << '\n';
+    result = EXIT_FAILURE;
+  }
+
+  MPI_Finalize();
+  return result;
+}
@@ -9,8 +9,8 @@
 
 namespace precice {
 namespace io {
-class TXTWriter;
-class TXTReader;
+class CheckpointReader;
+class CheckpointWriter;
 } // namespace io
 } // namespace precice
 
@@ -39,9 +39,11 @@ public:
 
   virtual void iterationsConverged(const DataMap &cpldata) = 0;
 
-  virtual void exportState(io::TXTWriter &writer) {}
+  /// Writes the state, which is carried over to the next time window, to a checkpoint
+  virtual void exportState(io::CheckpointWriter &writer) {}
 
-  virtual void importState(io::TXTReader &reader) {}
+  /// Reads the state written by exportState(), needs to be called after initialize()
+  virtual void importState(io::CheckpointReader &reader) {}
 
   /// Gives the number of QN columns that where filtered out (i.e. deleted) in this time window
   virtual int getDeletedColumns() const
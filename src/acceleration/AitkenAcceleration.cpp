@@ -9,11 +9,13 @@
 #include <utility>
 
 #include "cplscheme/CouplingData.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "math/math.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Helpers.hpp"
-#include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::acceleration {
@@ -76,9 +78,11 @@ void AitkenAcceleration::performAcceleration(
     _aitkenFactor = math::sign(_aitkenFactor) * std::min(_initialRelaxation, std::abs(_aitkenFactor));
   } else {
     // compute fraction of aitken factor with residuals and residual deltas
-    double nominator   = utils::IntraComm::dot(_residuals, residualDeltas);
-    double denominator = utils::IntraComm::dot(residualDeltas, residualDeltas);
-    _aitkenFactor      = -_aitkenFactor * (nominator / denominator);
+    utils::ReductionBatch sums;
+    const auto            nominator   = sums.add(_residuals.dot(residualDeltas));
+    const auto            denominator = sums.add(residualDeltas.squaredNorm());
+    sums.allreduceSum();
+    _aitkenFactor = -_aitkenFactor * (sums.get(nominator) / sums.get(denominator));
   }
 
   PRECICE_DEBUG("AitkenFactor: {}", _aitkenFactor);
@@ -108,4 +112,18 @@ void AitkenAcceleration::iterationsConverged(
   _residuals        = Eigen::VectorXd::Constant(_residuals.size(), std::numeric_limits<double>::max());
 }
 
+void AitkenAcceleration::exportState(
+    io::CheckpointWriter &writer)
+{
+  writer.writeTag("AitkenAcceleration");
+  writer.write(_aitkenFactor);
+}
+
+void AitkenAcceleration::importState(
+    io::CheckpointReader &reader)
+{
+  reader.readTag("AitkenAcceleration");
+  reader.read(_aitkenFactor);
+}
+
 } // namespace precice::acceleration
@@ -33,6 +33,12 @@ public:
   virtual void iterationsConverged(
       const DataMap &cpldata);
 
+  /// Exports the Aitken factor, which is carried over to the next time window
+  virtual void exportState(io::CheckpointWriter &writer);
+
+  /// Imports the Aitken factor written by exportState()
+  virtual void importState(io::CheckpointReader &reader);
+
 private:
   logging::Logger _log{"acceleration::AitkenAcceleration"};
 
@@ -9,6 +9,8 @@
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -16,14 +18,10 @@
 #include "utils/Event.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
-namespace io {
-class TXTReader;
-class TXTWriter;
-} // namespace io
-
 extern bool syncMode;
 namespace acceleration {
 
@@ -180,7 +178,18 @@ void BaseQNAcceleration::updateDifferenceMatrices(
   _residuals = _values;
   _residuals -= _oldValues;
 
-  if (math::equals(utils::IntraComm::l2norm(_residuals), 0.0)) {
+  // All norms required in this iteration are reduced at once
+  utils::ReductionBatch        squaredNorms;
+  const auto                   residualsIndex = squaredNorms.add(_residuals.squaredNorm());
+  utils::ReductionBatch::Index deltaRIndex    = 0;
+  utils::ReductionBatch::Index valuesIndex    = 0;
+  if (not _firstIteration) {
+    deltaRIndex = squaredNorms.add((_residuals - _oldResiduals).squaredNorm());
+    valuesIndex = squaredNorms.add(_values.squaredNorm());
+  }
+  squaredNorms.allreduceSum();
+
+  if (math::equals(squaredNorms.sqrt(residualsIndex), 0.0)) {
     PRECICE_WARN("The coupling residual equals almost zero. There is maybe something wrong in your adapter. "
                  "Maybe you always write the same data or you call advance without "
                  "providing new data first or you do not use available read data. "
@@ -210,10 +219,10 @@ void BaseQNAcceleration::updateDifferenceMatrices(
       Eigen::VectorXd deltaXTilde = _values;
       deltaXTilde -= _oldXTilde;
 
-      double residualMagnitude = utils::IntraComm::l2norm(deltaR);
-
-      if (not math::equals(utils::IntraComm::l2norm(_values), 0.0)) {
-        residualMagnitude /= utils::IntraComm::l2norm(_values);
+      double       residualMagnitude = squaredNorms.sqrt(deltaRIndex);
+      const double valuesNorm        = squaredNorms.sqrt(valuesIndex);
+      if (not math::equals(valuesNorm, 0.0)) {
+        residualMagnitude /= valuesNorm;
       }
 
       PRECICE_CHECK(not math::equals(residualMagnitude, 0.0),
@@ -589,13 +598,53 @@ void BaseQNAcceleration::removeMatrixColumn(
 }
 
 void BaseQNAcceleration::exportState(
-    io::TXTWriter &writer)
+    io::CheckpointWriter &writer)
 {
+  PRECICE_TRACE(getLSSystemCols());
+  writer.writeTag("BaseQNAcceleration");
+  writer.write(static_cast<int>(_firstTimeWindow));
+  writer.write(_matrixV);
+  writer.write(_matrixW);
+  writer.write(static_cast<int>(_matrixCols.size()));
+  for (int cols : _matrixCols) {
+    writer.write(cols);
+  }
+  _preconditioner->exportState(writer);
 }
 
 void BaseQNAcceleration::importState(
-    io::TXTReader &reader)
+    io::CheckpointReader &reader)
 {
+  reader.readTag("BaseQNAcceleration");
+  int firstTimeWindow;
+  reader.read(firstTimeWindow);
+  _firstTimeWindow = firstTimeWindow;
+  reader.read(_matrixV);
+  reader.read(_matrixW);
+  PRECICE_CHECK(_matrixV.cols() == 0 || _matrixV.rows() == _residuals.size(),
+                "The quasi-Newton state in the checkpoint has {} rows, but this rank has {} unknowns. "
+                "Please restart with the number of ranks of the run, which wrote the checkpoint.",
+                _matrixV.rows(), _residuals.size());
+  int timeWindows;
+  reader.read(timeWindows);
+  _matrixCols.clear();
+  for (int i = 0; i < timeWindows; ++i) {
+    int cols;
+    reader.read(cols);
+    _matrixCols.push_back(cols);
+  }
+  _preconditioner->importState(reader);
+
+  // The QR decomposition is computed from the preconditioned V
+  _qrV.reset();
+  _qrV.setGlobalRows(getLSSystemRows());
+  if (_matrixV.cols() > 0) {
+    _preconditioner->apply(_matrixV);
+    _qrV.reset(_matrixV, getLSSystemRows());
+    _preconditioner->revert(_matrixV);
+  }
+  _resetLS = true;
+  PRECICE_DEBUG("Imported {} columns of {} time windows", getLSSystemCols(), _matrixCols.size());
 }
 
 int BaseQNAcceleration::getDeletedColumns() const
@@ -50,8 +50,8 @@
 
 namespace precice {
 namespace io {
-class TXTReader;
-class TXTWriter;
+class CheckpointReader;
+class CheckpointWriter;
 } // namespace io
 
 namespace acceleration {
@@ -114,16 +114,18 @@ public:
   virtual void iterationsConverged(const DataMap &cplData);
 
   /**
-    * @brief Exports the current state of the acceleration to a file.
+    * @brief Exports the matrices V and W of the reused time windows and the preconditioner to a checkpoint.
+    *
+    * Has to be called after iterationsConverged().
     */
-  virtual void exportState(io::TXTWriter &writer);
+  virtual void exportState(io::CheckpointWriter &writer);
 
   /**
-    * @brief Imports the last exported state of the acceleration from file.
+    * @brief Imports the state written by exportState() and rebuilds the QR decomposition of V.
     *
-    * Is empty at the moment!!!
+    * Has to be called after initialize().
     */
-  virtual void importState(io::TXTReader &reader);
+  virtual void importState(io::CheckpointReader &reader);
 
   /// how many QN columns were deleted in this time window
   virtual int getDeletedColumns() const;
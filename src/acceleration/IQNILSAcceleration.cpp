@@ -12,6 +12,8 @@
 #include "com/SharedPointer.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Helpers.hpp"
@@ -263,6 +265,26 @@ void IQNILSAcceleration::specializedIterationsConverged(
   }
 }
 
+void IQNILSAcceleration::exportState(
+    io::CheckpointWriter &writer)
+{
+  BaseQNAcceleration::exportState(writer);
+  writer.writeTag("IQNILSAcceleration");
+  for (int id : _secondaryDataIDs) {
+    writer.write(_secondaryMatricesW[id]);
+  }
+}
+
+void IQNILSAcceleration::importState(
+    io::CheckpointReader &reader)
+{
+  BaseQNAcceleration::importState(reader);
+  reader.readTag("IQNILSAcceleration");
+  for (int id : _secondaryDataIDs) {
+    reader.read(_secondaryMatricesW[id]);
+  }
+}
+
 void IQNILSAcceleration::removeMatrixColumn(
     int columnIndex)
 {
@@ -48,6 +48,12 @@ public:
     */
   virtual void specializedIterationsConverged(const DataMap &cplData);
 
+  /// Exports the state of BaseQNAcceleration and the matrices W of the secondary data
+  virtual void exportState(io::CheckpointWriter &writer);
+
+  /// Imports the state written by exportState()
+  virtual void importState(io::CheckpointReader &reader);
+
 private:
   /// Secondary data solver output from last iteration.
   std::map<int, Eigen::VectorXd> _secondaryOldXTildes;
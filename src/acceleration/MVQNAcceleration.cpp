@@ -16,6 +16,8 @@
 #include "com/MPIPortsCommunication.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "precice/types.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -41,7 +43,8 @@ MVQNAcceleration::MVQNAcceleration(
     int                            imvjRestartType,
     int                            chunkSize,
     int                            RSLSreusedTimeWindows,
-    double                         RSSVDtruncationEps)
+    double                         RSSVDtruncationEps,
+    int                            RSSVDmaxRank)
     : BaseQNAcceleration(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, pastTimeWindowsReused,
                          filter, singularityLimit, std::move(dataIDs), preconditioner),
       //  _secondaryOldXTildes(),
@@ -63,6 +66,11 @@ MVQNAcceleration::MVQNAcceleration(
       _nbRestarts(0),
       _avgRank(0)
 {
+  _svdJ.setMaxRank(RSSVDmaxRank);
+  // The low-rank mode folds the update of every time window into the truncated SVD
+  if (_imvjRestartType == LOW_RANK) {
+    _chunkSize = 0;
+  }
 }
 
 // ==================================================================================
@@ -108,7 +116,7 @@ void MVQNAcceleration::initialize(
   _Wtil = Eigen::MatrixXd::Zero(entries, 0);
 
   if (utils::IntraComm::isPrimary() || !utils::IntraComm::isParallel()) {
-    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimeWindows << "\n--------\n"
+    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n max rank: " << _svdJ.getMaxRank() << "\n R_RS: " << _RSLSreusedTimeWindows << "\n--------\n"
                       << '\n';
   }
 }
@@ -497,7 +505,7 @@ void MVQNAcceleration::restartIMVJ()
   //int used_storage = 0;
   //int theoreticalJ_storage = 2*getLSSystemRows()*_residuals.size() + 3*_residuals.size()*getLSSystemCols() + _residuals.size()*_residuals.size();
   //               ------------ RESTART SVD ------------
-  if (_imvjRestartType == MVQNAcceleration::RS_SVD) {
+  if (_imvjRestartType == MVQNAcceleration::RS_SVD || _imvjRestartType == MVQNAcceleration::LOW_RANK) {
 
     // we need to compute the updated SVD of the scaled Jacobian matrix
     // |= APPLY PRECONDITIONING  J_prev = Wtil^q, Z^q  ===|
@@ -782,6 +790,53 @@ void MVQNAcceleration::specializedIterationsConverged(
   }
 }
 
+// ==================================================================================
+void MVQNAcceleration::exportState(
+    io::CheckpointWriter &writer)
+{
+  BaseQNAcceleration::exportState(writer);
+  writer.writeTag("MVQNAcceleration");
+  writer.write(_oldInvJacobian);
+  writer.write(static_cast<int>(_WtilChunk.size()));
+  for (std::size_t i = 0; i < _WtilChunk.size(); ++i) {
+    writer.write(_WtilChunk[i]);
+    writer.write(_pseudoInverseChunk[i]);
+  }
+  writer.write(_matrixV_RSLS);
+  writer.write(_matrixW_RSLS);
+  writer.write(static_cast<int>(_matrixCols_RSLS.size()));
+  for (int cols : _matrixCols_RSLS) {
+    writer.write(cols);
+  }
+}
+
+// ==================================================================================
+void MVQNAcceleration::importState(
+    io::CheckpointReader &reader)
+{
+  BaseQNAcceleration::importState(reader);
+  reader.readTag("MVQNAcceleration");
+  reader.read(_oldInvJacobian);
+  int chunks;
+  reader.read(chunks);
+  _WtilChunk.resize(chunks);
+  _pseudoInverseChunk.resize(chunks);
+  for (int i = 0; i < chunks; ++i) {
+    reader.read(_WtilChunk[i]);
+    reader.read(_pseudoInverseChunk[i]);
+  }
+  reader.read(_matrixV_RSLS);
+  reader.read(_matrixW_RSLS);
+  int timeWindows;
+  reader.read(timeWindows);
+  _matrixCols_RSLS.clear();
+  for (int i = 0; i < timeWindows; ++i) {
+    int cols;
+    reader.read(cols);
+    _matrixCols_RSLS.push_back(cols);
+  }
+}
+
 // ==================================================================================
 void MVQNAcceleration::removeMatrixColumn(
     int columnIndex)
@@ -37,6 +37,7 @@ public:
   static const int RS_LS      = 2;
   static const int RS_SVD     = 3;
   static const int RS_SLIDE   = 4;
+  static const int LOW_RANK   = 5;
 
   /**
    * @brief Constructor.
@@ -54,7 +55,8 @@ public:
       int                            imvjRestartType,
       int                            chunkSize,
       int                            RSLSreusedTimeWindows,
-      double                         RSSVDtruncationEps);
+      double                         RSSVDtruncationEps,
+      int                            RSSVDmaxRank);
 
   /**
     * @brief Destructor, empty.
@@ -74,6 +76,18 @@ public:
     */
   virtual void specializedIterationsConverged(const DataMap &cplData);
 
+  /**
+    * @brief Exports the state of BaseQNAcceleration, the inverse Jacobian of the last time window, and the
+    *        matrices of the restart mode to a checkpoint.
+    *
+    * The truncated SVD of the restart modes RS-SVD and low-rank is not exported, but rebuilt from its stored factors
+    * at the next restart of the IMVJ.
+    */
+  virtual void exportState(io::CheckpointWriter &writer);
+
+  /// Imports the state written by exportState()
+  virtual void importState(io::CheckpointReader &reader);
+
 private:
   /// @brief stores the approximation of the inverse Jacobian of the system at current time window.
   Eigen::MatrixXd _invJacobian;
@@ -116,6 +130,8 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time windows all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time windows restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time windows, update of an truncated SVD of the Jacobian.
+    *  - LOW_RANK:   imvj in restart mode. After every time window, update of an truncated SVD of the Jacobian.
+    *                The Jacobian is only represented by the distributed low-rank factors of the SVD.
     */
   int _imvjRestartType;
 
@@ -52,6 +52,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       ATTR_IMVJCHUNKSIZE("chunk-size"),
       ATTR_RSLS_REUSED_TIME_WINDOWS("reused-time-windows-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
+      ATTR_RSSVD_MAXRANK("max-rank"),
       ATTR_PRECOND_NONCONST_TIME_WINDOWS("freeze-after"),
       VALUE_CONSTANT("constant"),
       VALUE_AITKEN("aitken"),
@@ -69,6 +70,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       VALUE_ZERO_RESTART("RS-0"),
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
+      VALUE_LOW_RANK("low-rank"),
       VALUE_NO_RESTART("no-restart"),
       _meshConfig(meshConfig),
       _acceleration(),
@@ -221,9 +223,14 @@ void AccelerationConfiguration::xmlTagCallback(
       _config.imvjRestartType            = MVQNAcceleration::RS_LS;
     } else if (f == VALUE_SVD_RESTART) {
       _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRSSVD_maxRank       = callingTag.getIntAttributeValue(ATTR_RSSVD_MAXRANK);
       _config.imvjRestartType         = MVQNAcceleration::RS_SVD;
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = MVQNAcceleration::RS_SLIDE;
+    } else if (f == VALUE_LOW_RANK) {
+      _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRSSVD_maxRank       = callingTag.getIntAttributeValue(ATTR_RSSVD_MAXRANK);
+      _config.imvjRestartType         = MVQNAcceleration::LOW_RANK;
     } else {
       _config.imvjChunkSize = 0;
       PRECICE_ASSERT(false);
@@ -249,6 +256,10 @@ void AccelerationConfiguration::xmlEndTagCallback(
         if (_config.precond_nbNonConstTWindows > _config.imvjChunkSize)
           _config.precond_nbNonConstTWindows = _config.imvjChunkSize;
 
+      // in the low-rank mode, the SVD is updated after every time window, hence the preconditioner has to be frozen after the first one
+      if (callingTag.getName() == VALUE_MVQN && _config.imvjRestartType == MVQNAcceleration::LOW_RANK)
+        _config.precond_nbNonConstTWindows = 1;
+
       if (_config.preconditionerType == VALUE_CONSTANT_PRECONDITIONER) {
         std::vector<double> factors;
         for (int id : _config.dataIDs) {
@@ -304,7 +315,8 @@ void AccelerationConfiguration::xmlEndTagCallback(
               _config.imvjRestartType,
               _config.imvjChunkSize,
               _config.imvjRSLS_reusedTimeWindows,
-              _config.imvjRSSVD_truncationEps));
+              _config.imvjRSSVD_truncationEps,
+              _config.imvjRSSVD_maxRank));
 #else
       PRECICE_ERROR("Acceleration IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -461,7 +473,8 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                             VALUE_ZERO_RESTART,
                                             VALUE_LS_RESTART,
                                             VALUE_SVD_RESTART,
-                                            VALUE_SLIDE_RESTART})
+                                            VALUE_SLIDE_RESTART,
+                                            VALUE_LOW_RANK})
                                .setDefaultValue(VALUE_SVD_RESTART)
                                .setDocumentation("Type of the restart mode.");
     tagIMVJRESTART.addAttribute(attrRestartName);
@@ -470,16 +483,23 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                     "- `RS-ZERO`:    IMVJ runs in restart mode. After M time windows all Jacobain information is dropped, restart with no information\n"
                                     "- `RS-LS`:      IMVJ runs in restart mode. After M time windows a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "- `RS-SVD`:     IMVJ runs in restart mode. After M time windows a truncated SVD of the Jacobian is updated.\n"
-                                    "- `RS-SLIDE`:   IMVJ runs in sliding window restart mode.\n");
+                                    "- `RS-SLIDE`:   IMVJ runs in sliding window restart mode.\n"
+                                    "- `low-rank`:   IMVJ runs in restart mode. After every time window a truncated SVD of the Jacobian is updated. "
+                                    "The Jacobian is only stored as distributed low-rank factors, hence memory and cost grow linearly with the interface size. "
+                                    "The chunk size is ignored.\n");
     auto attrChunkSize = makeXMLAttribute(ATTR_IMVJCHUNKSIZE, 8)
                              .setDocumentation("Specifies the number of time windows M after which the IMVJ restarts, if run in restart-mode. Default value is M=8.");
     auto attrReusedTimeWindowsAtRestart = makeXMLAttribute(ATTR_RSLS_REUSED_TIME_WINDOWS, 8)
                                               .setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time windows at restart can be specified.");
     auto attrRSSVD_truncationEps = makeXMLAttribute(ATTR_RSSVD_TRUNCATIONEPS, 1e-4)
-                                       .setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
+                                       .setDocumentation("If IMVJ restart-mode=RS-SVD or low-rank, the truncation threshold for the updated SVD can be set.");
+    auto attrRSSVD_maxRank = makeXMLAttribute(ATTR_RSSVD_MAXRANK, 0)
+                                 .setDocumentation("If IMVJ restart-mode=RS-SVD or low-rank, the rank of the updated SVD can be limited. "
+                                                   "The default value 0 does not limit the rank.");
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeWindowsAtRestart);
     tagIMVJRESTART.addAttribute(attrRSSVD_truncationEps);
+    tagIMVJRESTART.addAttribute(attrRSSVD_maxRank);
     tag.addSubtag(tagIMVJRESTART);
 
     XMLTag tagMaxUsedIter(*this, TAG_MAX_USED_ITERATIONS, XMLTag::OCCUR_ONCE);
@@ -64,6 +64,7 @@ private:
   const std::string ATTR_IMVJCHUNKSIZE;
   const std::string ATTR_RSLS_REUSED_TIME_WINDOWS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
+  const std::string ATTR_RSSVD_MAXRANK;
   const std::string ATTR_PRECOND_NONCONST_TIME_WINDOWS;
 
   const std::string VALUE_CONSTANT;
@@ -82,6 +83,7 @@ private:
   const std::string VALUE_ZERO_RESTART;
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
+  const std::string VALUE_LOW_RANK;
   const std::string VALUE_NO_RESTART;
 
   const mesh::PtrMeshConfiguration _meshConfig;
@@ -109,6 +111,7 @@ private:
     int                   imvjRestartType            = 0;
     int                   imvjChunkSize              = 0;
     int                   imvjRSLS_reusedTimeWindows = 0;
+    int                   imvjRSSVD_maxRank          = 0;
     int                   precond_nbNonConstTWindows = -1;
     double                singularityLimit           = 0;
     double                imvjRSSVD_truncationEps    = 0;
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <utility>
 #include <vector>
 
 #include "cplscheme/SharedPointer.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
 #include "utils/assertion.hpp"
@@ -202,6 +205,35 @@ public:
     return _frozen;
   }
 
+  /// Writes the weights and the number of updated time windows to the checkpoint
+  void exportState(io::CheckpointWriter &writer) const
+  {
+    writer.writeTag("Preconditioner");
+    writer.write(_weights);
+    writer.write(_invWeights);
+    writer.write(_nbNonConstTimeWindows);
+    writer.write(static_cast<int>(_frozen));
+  }
+
+  /// Reads the state written by exportState()
+  void importState(io::CheckpointReader &reader)
+  {
+    reader.readTag("Preconditioner");
+    std::vector<double> weights;
+    reader.read(weights);
+    PRECICE_CHECK(weights.size() == _weights.size(),
+                  "The checkpoint contains {} preconditioner weights, but {} are required. "
+                  "Please restart with the number of ranks of the run, which wrote the checkpoint.",
+                  weights.size(), _weights.size());
+    _weights = std::move(weights);
+    reader.read(_invWeights);
+    reader.read(_nbNonConstTimeWindows);
+    int frozen;
+    reader.read(frozen);
+    _frozen       = frozen;
+    _requireNewQR = false;
+  }
+
 protected:
   /// Weights used to scale the matrix V and the residual
   std::vector<double> _weights;
@@ -3,7 +3,7 @@
 #include <cmath>
 #include "logging/LogMacros.hpp"
 #include "math/differences.hpp"
-#include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::acceleration::impl {
@@ -27,20 +27,20 @@ void ResidualSumPreconditioner::_update_(bool                   timeWindowComple
                                          const Eigen::VectorXd &res)
 {
   if (not timeWindowComplete) {
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
-
-    double sum = 0.0;
-
-    int offset = 0;
+    // The squared norms of all sub-vectors are reduced at once
+    utils::ReductionBatch squaredNorms;
+    int                   offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = res(i + offset);
-      }
-      norms[k] = utils::IntraComm::dot(part, part);
-      sum += norms[k];
+      squaredNorms.add(res.segment(offset, _subVectorSizes[k]).squaredNorm());
       offset += _subVectorSizes[k];
-      norms[k] = std::sqrt(norms[k]);
+    }
+    squaredNorms.allreduceSum();
+
+    std::vector<double> norms(_subVectorSizes.size(), 0.0);
+    double              sum = 0.0;
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      sum += squaredNorms.get(k);
+      norms[k] = squaredNorms.sqrt(k);
     }
     sum = std::sqrt(sum);
     if (math::equals(sum, 0.0)) {
@@ -276,6 +276,17 @@ double SVDFactorization::getThreshold()
   return _truncationEps;
 }
 
+void SVDFactorization::setMaxRank(int maxRank)
+{
+  PRECICE_ASSERT(maxRank >= 0, maxRank);
+  _maxRank = maxRank;
+}
+
+int SVDFactorization::getMaxRank()
+{
+  return _maxRank;
+}
+
 int SVDFactorization::getWaste()
 {
   int r  = _waste;
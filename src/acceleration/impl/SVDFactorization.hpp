@@ -10,6 +10,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <algorithm>
 #include <string>
 
 #include "acceleration/impl/ParallelMatrixOperations.hpp"
@@ -154,14 +155,16 @@ public:
       */
     _cols = _sigma.size();
 
-    int waste = 0;
     for (int i = 0; i < (int) _sigma.size(); i++) {
-      if (_sigma(i) < (int) _sigma(0) * _truncationEps) {
+      if (_sigma(i) < _sigma(0) * _truncationEps) {
         _cols = i;
-        waste = _sigma.size() - i;
         break;
       }
     }
+    if (_maxRank > 0) {
+      _cols = std::min(_cols, _maxRank);
+    }
+    const int waste = _sigma.size() - _cols;
     _waste += waste;
 
     _psi.conservativeResize(_rows, _cols);
@@ -216,6 +219,12 @@ public:
   /// @brief: returns the truncation threshold for the SVD
   double getThreshold();
 
+  /// @brief: limits the rank of the truncated SVD, 0 disables the limit
+  void setMaxRank(int maxRank);
+
+  /// @brief: returns the maximal rank of the truncated SVD, 0 if unlimited
+  int getMaxRank();
+
   /// @brief: applies the preconditioner to the factorized and truncated representation of the Jacobian matrix
   //void applyPreconditioner();
 
@@ -277,6 +286,9 @@ private:
   /// Truncation parameter for the updated SVD decomposition
   double _truncationEps;
 
+  /// Maximal rank of the truncated SVD decomposition, 0 if unlimited
+  int _maxRank = 0;
+
   /// Threshold for the QR2 filter for the QR decomposition.
   double _epsQR2 = 1e-3;
 
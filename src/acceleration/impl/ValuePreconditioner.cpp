@@ -1,7 +1,7 @@
 #include "acceleration/impl/ValuePreconditioner.hpp"
 #include <cstddef>
 #include <vector>
-#include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::acceleration::impl {
@@ -18,16 +18,18 @@ void ValuePreconditioner::_update_(bool                   timeWindowComplete,
 {
   if (timeWindowComplete || _firstTimeWindow) {
 
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
-
-    int offset = 0;
+    // The squared norms of all sub-vectors are reduced at once
+    utils::ReductionBatch squaredNorms;
+    int                   offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = oldValues(i + offset);
-      }
-      norms[k] = utils::IntraComm::l2norm(part);
+      squaredNorms.add(oldValues.segment(offset, _subVectorSizes[k]).squaredNorm());
       offset += _subVectorSizes[k];
+    }
+    squaredNorms.allreduceSum();
+
+    std::vector<double> norms(_subVectorSizes.size(), 0.0);
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      norms[k] = squaredNorms.sqrt(k);
       PRECICE_ASSERT(norms[k] > 0.0);
     }
 
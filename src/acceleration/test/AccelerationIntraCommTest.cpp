@@ -270,6 +270,7 @@ BOOST_AUTO_TEST_CASE(testVIQNIMVJpp)
   int    reusedTimeWindowsAtRestart = 0;
   double singularityLimit           = 1e-10;
   double svdTruncationEps           = 0.0;
+  int    svdMaxRank                 = 0;
   bool   enforceInitialRelaxation   = false;
   bool   alwaysBuildJacobian        = false;
 
@@ -286,7 +287,7 @@ BOOST_AUTO_TEST_CASE(testVIQNIMVJpp)
 
   MVQNAcceleration pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
                       timeWindowsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-                      restartType, chunkSize, reusedTimeWindowsAtRestart, svdTruncationEps);
+                      restartType, chunkSize, reusedTimeWindowsAtRestart, svdTruncationEps, svdMaxRank);
 
   Eigen::VectorXd dcol1;
   Eigen::VectorXd fcol1;
@@ -546,6 +547,7 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp)
   int    reusedTimeWindowsAtRestart = 0;
   double singularityLimit           = 1e-2;
   double svdTruncationEps           = 0.0;
+  int    svdMaxRank                 = 0;
   bool   enforceInitialRelaxation   = false;
   bool   alwaysBuildJacobian        = false;
 
@@ -560,7 +562,7 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp)
 
   MVQNAcceleration pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
                       timeWindowsReused, filter, singularityLimit, dataIDs, _preconditioner, alwaysBuildJacobian,
-                      restartType, chunkSize, reusedTimeWindowsAtRestart, svdTruncationEps);
+                      restartType, chunkSize, reusedTimeWindowsAtRestart, svdTruncationEps, svdMaxRank);
 
   mesh::PtrData displacements(new mesh::Data("dvalues", -1, 2));
   mesh::PtrData forces(new mesh::Data("fvalues", -1, 2));
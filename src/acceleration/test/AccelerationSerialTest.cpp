@@ -1,5 +1,7 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <memory>
+#include <string>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/BaseQNAcceleration.hpp"
 #include "acceleration/IQNILSAcceleration.hpp"
@@ -10,6 +12,8 @@
 #include "acceleration/impl/SharedPointer.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -42,6 +46,7 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   int              restartType              = MVQNAcceleration::NO_RESTART;
   double           singularityLimit         = 1e-10;
   double           svdTruncationEps         = 0.0;
+  int              svdMaxRank               = 0;
   bool             enforceInitialRelaxation = false;
   bool             alwaysBuildJacobian      = false;
   std::vector<int> dataIDs;
@@ -54,7 +59,7 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
 
   MVQNAcceleration pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
                       timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-                      restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+                      restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps, svdMaxRank);
 
   Eigen::VectorXd fcol1;
 
@@ -189,6 +194,145 @@ BOOST_AUTO_TEST_CASE(testVIQNPP)
   BOOST_TEST(testing::equals(data.at(1)->values()(3), 8.28025852497733944046e-02));
 }
 
+BOOST_AUTO_TEST_CASE(testMVQNLowRank)
+{
+  PRECICE_TEST(1_rank);
+  // Without truncation, the low-rank representation of the inverse Jacobian yields the same iterates as the explicit one
+
+  std::vector<int> dataIDs{0, 1};
+  mesh::PtrMesh    dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+
+  auto createAcceleration = [&dataIDs](int restartType) {
+    acceleration::impl::PtrPreconditioner prec(new acceleration::impl::ConstantPreconditioner(std::vector<double>(2, 1.0)));
+    const int                             filter = Acceleration::QR1FILTER;
+    return std::make_shared<MVQNAcceleration>(0.1, false, 50, 0, filter, 1e-10, dataIDs, prec,
+                                              false, restartType, 8, 0, 1e-14, 0);
+  };
+
+  auto createData = [&dummyMesh]() {
+    DataMap data;
+    for (int id : {0, 1}) {
+      mesh::PtrData values(new mesh::Data("values" + std::to_string(id), -1, 1));
+      values->values() = Eigen::VectorXd::Zero(4);
+      data.emplace(id, std::make_shared<cplscheme::CouplingData>(values, dummyMesh, false));
+      data.at(id)->storeIteration();
+    }
+    return data;
+  };
+
+  // Linear fixed-point problem x = A * x + b over both data
+  Eigen::MatrixXd A = 0.5 * Eigen::MatrixXd::Identity(8, 8);
+  for (int i = 0; i < 8; ++i) {
+    A(i, (i + 3) % 8) += 0.2;
+    A((i + 5) % 8, i) -= 0.1;
+  }
+
+  auto explicitJacobian = createAcceleration(MVQNAcceleration::NO_RESTART);
+  auto lowRank          = createAcceleration(MVQNAcceleration::LOW_RANK);
+  auto explicitData     = createData();
+  auto lowRankData      = createData();
+  explicitJacobian->initialize(explicitData);
+  lowRank->initialize(lowRankData);
+
+  for (int window = 0; window < 4; ++window) {
+    Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(8, 1.0, 2.0 + window);
+    for (int iteration = 0; iteration < 4; ++iteration) {
+      for (DataMap *data : {&explicitData, &lowRankData}) {
+        Eigen::VectorXd x(8);
+        x << data->at(0)->previousIteration(), data->at(1)->previousIteration();
+        const Eigen::VectorXd y = A * x + b;
+        data->at(0)->values()   = y.head(4);
+        data->at(1)->values()   = y.tail(4);
+      }
+      explicitJacobian->performAcceleration(explicitData);
+      lowRank->performAcceleration(lowRankData);
+      for (int id : dataIDs) {
+        BOOST_TEST(testing::equals(lowRankData.at(id)->values(), explicitData.at(id)->values(), 1e-8));
+        explicitData.at(id)->storeIteration();
+        lowRankData.at(id)->storeIteration();
+      }
+    }
+    explicitJacobian->iterationsConverged(explicitData);
+    lowRank->iterationsConverged(lowRankData);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIQNILSCheckpoint)
+{
+  PRECICE_TEST(1_rank);
+  // An acceleration restored from a checkpoint has to continue exactly like the original one
+
+  std::vector<int> dataIDs{0, 1};
+  mesh::PtrMesh    dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+
+  auto createAcceleration = [&dataIDs]() {
+    acceleration::impl::PtrPreconditioner prec(new acceleration::impl::ConstantPreconditioner(std::vector<double>(2, 1.0)));
+    return IQNILSAcceleration(0.01, false, 50, 6, acceleration::BaseQNAcceleration::QR1FILTER, 1e-10, dataIDs, prec);
+  };
+
+  auto createData = [&dummyMesh]() {
+    mesh::PtrData displacements(new mesh::Data("dvalues", -1, 1));
+    mesh::PtrData forces(new mesh::Data("fvalues", -1, 1));
+    displacements->values().resize(4);
+    displacements->values() << 1.0, 1.0, 1.0, 1.0;
+    forces->values().resize(4);
+    forces->values() << 0.2, 0.2, 0.2, 0.2;
+
+    DataMap data;
+    data.emplace(0, std::make_shared<cplscheme::CouplingData>(displacements, dummyMesh, false));
+    data.emplace(1, std::make_shared<cplscheme::CouplingData>(forces, dummyMesh, false));
+    for (auto &pair : data) {
+      pair.second->storeIteration();
+    }
+    return data;
+  };
+
+  IQNILSAcceleration original     = createAcceleration();
+  DataMap            originalData = createData();
+  original.initialize(originalData);
+
+  // First time window
+  originalData.at(0)->values() << 1.0, 2.0, 3.0, 4.0;
+  originalData.at(1)->values() << 0.1, 0.1, 0.1, 0.1;
+  original.performAcceleration(originalData);
+  originalData.at(0)->values() << 10.0, 10.0, 10.0, 10.0;
+  original.performAcceleration(originalData);
+  original.iterationsConverged(originalData);
+
+  const std::string filename = "acceleration-IQNILSCheckpoint.checkpoint";
+  {
+    io::CheckpointWriter writer(filename);
+    for (const auto &pair : originalData) {
+      pair.second->exportState(writer);
+    }
+    original.exportState(writer);
+    writer.close();
+  }
+
+  IQNILSAcceleration restored     = createAcceleration();
+  DataMap            restoredData = createData();
+  restored.initialize(restoredData);
+  {
+    io::CheckpointReader reader(filename);
+    for (const auto &pair : restoredData) {
+      pair.second->importState(reader, true);
+    }
+    restored.importState(reader);
+  }
+
+  // Second time window, which reuses the columns of the first one
+  for (DataMap *data : {&originalData, &restoredData}) {
+    data->at(0)->values() << 2.0, 3.0, 4.0, 5.0;
+    data->at(1)->values() << 0.3, 0.3, 0.3, 0.3;
+  }
+  original.performAcceleration(originalData);
+  restored.performAcceleration(restoredData);
+
+  BOOST_TEST(original.getLSSystemCols() == restored.getLSSystemCols());
+  BOOST_TEST(testing::equals(restoredData.at(0)->values(), originalData.at(0)->values()));
+  BOOST_TEST(testing::equals(restoredData.at(1)->values(), originalData.at(1)->values()));
+}
+
 #endif // not PRECICE_NO_MPI
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -49,12 +49,13 @@ void ComputeCurvatureAction::performAction(
     for (int i = 0; i < dataValues.size(); i++) {
       dataValues[i] = 0.0;
     }
-    Eigen::Vector3d normal;
-    Eigen::Vector3d edge;
-    Eigen::Vector3d contribution;
+    const Eigen::MatrixXd &normals = getMesh()->getTriangleNormals();
+    Eigen::Vector3d        normal;
+    Eigen::Vector3d        edge;
+    Eigen::Vector3d        contribution;
 
     for (mesh::Triangle &tri : getMesh()->triangles()) {
-      normal = tri.computeNormal();
+      normal = normals.col(tri.getID());
       for (int i = 0; i < 3; i++) {
         mesh::Vertex &v0 = tri.vertex(i);
         mesh::Vertex &v1 = tri.vertex((i + 1) % 3);
@@ -3,6 +3,7 @@
 #include "PythonAction.hpp"
 #include <Eigen/Core>
 #include <Python.h>
+#include <algorithm>
 #include <boost/filesystem/operations.hpp>
 #include <cstdlib>
 #include <memory>
@@ -122,9 +123,18 @@ PythonAction::~PythonAction()
   if (_module != nullptr) {
     PRECICE_ASSERT(_moduleNameObject != nullptr);
     PRECICE_ASSERT(_module != nullptr);
-    Py_DECREF(_moduleNameObject);
-    Py_DECREF(_module);
-    Py_Finalize();
+    if (_threadState != nullptr) {
+      // This action initialized Python, reacquire the GIL and shut the interpreter down
+      PyEval_RestoreThread(_threadState);
+      Py_DECREF(_moduleNameObject);
+      Py_DECREF(_module);
+      Py_Finalize();
+    } else {
+      PyGILState_STATE gilState = PyGILState_Ensure();
+      Py_DECREF(_moduleNameObject);
+      Py_DECREF(_module);
+      PyGILState_Release(gilState);
+    }
   }
 }
 
@@ -138,6 +148,9 @@ void PythonAction::performAction(double time,
   if (not _isInitialized)
     initialize();
 
+  // The GIL is only held while calling into Python, the solver runs without it in between.
+  PyGILState_STATE gilState = PyGILState_Ensure();
+
   PyObject *dataArgs = PyTuple_New(_numberArguments);
   if (_performAction != nullptr) {
     PyObject *pythonTime           = PyFloat_FromDouble(time);
@@ -170,7 +183,9 @@ void PythonAction::performAction(double time,
     }
   }
 
-  if (_vertexCallback != nullptr) {
+  if (_vectorizedVertexCallback != nullptr) {
+    callVectorizedVertexCallback();
+  } else if (_vertexCallback != nullptr) {
     // The arguments is a tuple of (id, coord) or (id, coord, normal).
     // The deprecated normal is optional and None will be passed if it was defined.
     PRECICE_ASSERT(_vertexCallbackArgs == 2 || _vertexCallbackArgs == 3, _vertexCallbackArgs);
@@ -212,13 +227,70 @@ void PythonAction::performAction(double time,
   }
 
   Py_DECREF(dataArgs);
+  PyGILState_Release(gilState);
+}
+
+void PythonAction::callVectorizedVertexCallback()
+{
+  PRECICE_TRACE();
+  mesh::PtrMesh mesh = getMesh();
+
+  // IDs and coordinates are gathered into contiguous buffers, data values are handed over without copies.
+  const npy_intp numberOfVertices = mesh->vertices().size();
+  const int      dimensions       = mesh->getDimensions();
+  _vertexIDs.resize(numberOfVertices);
+  _vertexCoords.resize(numberOfVertices * dimensions);
+  auto coordsIter = _vertexCoords.begin();
+  for (npy_intp i = 0; i < numberOfVertices; ++i) {
+    const mesh::Vertex &vertex = mesh->vertices()[i];
+    _vertexIDs[i]              = vertex.getID();
+    coordsIter                 = std::copy_n(vertex.rawCoords().begin(), dimensions, coordsIter);
+  }
+
+  // The arguments are a tuple of (ids, coords, sourceData, targetData), data is omitted if not configured.
+  PyObject *vertexArgs = PyTuple_New(_numberArguments);
+
+  npy_intp  idsDim[] = {numberOfVertices};
+  PyObject *pythonIDs = PyArray_SimpleNewFromData(1, idsDim, NPY_INT, _vertexIDs.data());
+  PRECICE_CHECK(pythonIDs != nullptr, "Creating python IDs failed. Please check that the python-actions mesh name is correct.");
+  PyTuple_SetItem(vertexArgs, 0, pythonIDs);
+
+  npy_intp  coordsDim[]  = {numberOfVertices, dimensions};
+  PyObject *pythonCoords = PyArray_SimpleNewFromData(2, coordsDim, NPY_DOUBLE, _vertexCoords.data());
+  PRECICE_CHECK(pythonCoords != nullptr, "Creating python coords failed. Please check that the python-actions mesh name is correct.");
+  PyTuple_SetItem(vertexArgs, 1, pythonCoords);
+
+  int argumentIndex = 2;
+  for (const mesh::PtrData &data : {_sourceData, _targetData}) {
+    if (not data) {
+      continue;
+    }
+    PRECICE_ASSERT(data->values().size() == numberOfVertices * data->getDimensions(), data->values().size(), numberOfVertices);
+    npy_intp  valuesDim[]  = {numberOfVertices, data->getDimensions()};
+    PyObject *pythonValues = PyArray_SimpleNewFromData(2, valuesDim, NPY_DOUBLE, data->values().data());
+    PRECICE_CHECK(pythonValues != nullptr, "Creating python values of data \"{}\" failed. Please check that the data name is used by the mesh in action:python.", data->getName());
+    PyTuple_SetItem(vertexArgs, argumentIndex, pythonValues);
+    ++argumentIndex;
+  }
+
+  PyObject_CallObject(_vectorizedVertexCallback, vertexArgs);
+  if (PyErr_Occurred()) {
+    PRECICE_ERROR("Error occurred during call of function vectorizedVertexCallback() in python module \"{}\". "
+                  "The error message is: {}",
+                  _moduleName, python_error_as_string());
+  }
+  Py_DECREF(vertexArgs);
 }
 
 void PythonAction::initialize()
 {
   PRECICE_ASSERT(not _isInitialized);
-  // Initialize Python
-  Py_Initialize();
+  // Initialize Python, unless another python action already did so
+  const bool initializesPython = not Py_IsInitialized();
+  if (initializesPython) {
+    Py_Initialize();
+  }
+  PyGILState_STATE gilState = PyGILState_Ensure();
   makeNumPyArraysAvailable();
   // Append execution path to find module to import
   PyRun_SimpleString("import sys");
@@ -242,12 +314,25 @@ void PythonAction::initialize()
   //  if (not valid){
   //  }
 
+  // Construct method vectorizedVertexCallback, which replaces vertexCallback if defined
+  _vectorizedVertexCallback = PyObject_GetAttrString(_module, "vectorizedVertexCallback");
+  if (PyErr_Occurred()) {
+    PyErr_Clear();
+    _vectorizedVertexCallback = nullptr;
+  }
+
   // Construct method vertexCallback
   _vertexCallback = PyObject_GetAttrString(_module, "vertexCallback");
   if (PyErr_Occurred()) {
     PyErr_Clear();
-    PRECICE_WARN("Python module \"{}\" does not define function vertexCallback().", _moduleName);
+    if (_vectorizedVertexCallback == nullptr) {
+      PRECICE_WARN("Python module \"{}\" does not define function vertexCallback() or vectorizedVertexCallback().", _moduleName);
+    }
     _vertexCallback = nullptr;
+  } else if (_vectorizedVertexCallback != nullptr) {
+    PRECICE_WARN("Python module \"{}\" defines both functions vertexCallback() and vectorizedVertexCallback(). "
+                 "Only vectorizedVertexCallback() will be called.",
+                 _moduleName);
   } else {
     _vertexCallbackArgs = python_func_args(_vertexCallback).size();
     if (_vertexCallbackArgs == 3) {
@@ -269,6 +354,13 @@ void PythonAction::initialize()
     PRECICE_WARN("Python module \"{}\" does not define function postAction().", _moduleName);
     _postAction = nullptr;
   }
+
+  PyGILState_Release(gilState);
+  if (initializesPython) {
+    // Release the GIL, it is reacquired whenever the action is performed
+    _threadState = PyEval_SaveThread();
+  }
+  _isInitialized = true;
 }
 
 int PythonAction::makeNumPyArraysAvailable()
@@ -2,12 +2,15 @@
 #ifndef PRECICE_NO_PYTHON
 
 #include <string>
+#include <vector>
 #include "action/Action.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 
 struct _object;
 using PyObject = _object;
+struct _ts;
+using PyThreadState = _ts;
 
 namespace precice {
 namespace action {
@@ -60,10 +63,24 @@ private:
 
   int _vertexCallbackArgs = 0;
 
+  PyObject *_vectorizedVertexCallback = nullptr;
+
   PyObject *_postAction = nullptr;
 
+  /// Thread state of the interpreter while the GIL is released, only set if this action initialized Python.
+  PyThreadState *_threadState = nullptr;
+
+  /// Contiguous copy of the vertex IDs handed to vectorizedVertexCallback().
+  std::vector<int> _vertexIDs;
+
+  /// Contiguous row-major copy of the vertex coordinates handed to vectorizedVertexCallback().
+  std::vector<double> _vertexCoords;
+
   void initialize();
 
+  /// Calls vectorizedVertexCallback() once with the data of all vertices of the mesh.
+  void callVectorizedVertexCallback();
+
   int makeNumPyArraysAvailable();
 };
 
@@ -26,6 +26,17 @@ def vertexCallback(id, coords, normal):
     global myTargetData
     # myTargetData[id] += coords[0] + mySourceData[id] # Add data to vertex coords
 
+def vectorizedVertexCallback(ids, coords, sourceData, targetData):
+    '''This function is called once for all vertices of the configured mesh. It is called
+    after performAction, replaces vertexCallback if defined, and can also be omitted.
+    Its parameters are the vertex IDs, the vertex coordinates as (vertices x dimensions) array,
+    followed by the source and the target data as (vertices x data dimensions) arrays.
+    Source and target data are omitted if not mentioned in the preCICE XML configuration.
+    The data arrays are views on the preCICE data, the IDs and coordinates are copies.'''
+
+    # Usage example:
+    # targetData[:, 0] += coords[:, 0] + sourceData[:, 0] # Add data to vertex coords
+
 def postAction():
     '''This function is called at last, if not omitted.'''
 
@@ -42,6 +42,26 @@ BOOST_AUTO_TEST_CASE(AllMethods)
   BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
 }
 
+BOOST_AUTO_TEST_CASE(VectorizedVertexCallback)
+{
+  PRECICE_TEST(1_rank);
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector3d::Constant(1.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(2.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(3.0));
+  int targetID = mesh->createData("TargetData", 2, 0_dataID)->getID();
+  int sourceID = mesh->createData("SourceData", 2, 1_dataID)->getID();
+  mesh->allocateDataValues();
+  std::string  path = testing::getPathToSources() + "/action/tests/";
+  PythonAction action(PythonAction::WRITE_MAPPING_PRIOR, path, "TestVectorizedAction", mesh, targetID, sourceID);
+  mesh->data(sourceID)->values() << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6;
+  mesh->data(targetID)->values() = Eigen::VectorXd::Zero(mesh->data(targetID)->values().size());
+  action.performAction(0.0, 0.0, 0.0, 0.0);
+  Eigen::VectorXd result(6);
+  result << 1.1, 1.2, 2.3, 2.4, 3.5, 3.6;
+  BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
+}
+
 BOOST_AUTO_TEST_CASE(OmitMethods)
 {
   PRECICE_TEST(1_rank);
@@ -0,0 +1,8 @@
+#
+# This function is called once for all vertices in the configured mesh. Its
+# parameters are the vertex IDs and coordinates, followed by the source and
+# target data as two-dimensional arrays.
+#
+def vectorizedVertexCallback(ids, coords, sourceData, targetData):
+    # Usage example:
+    targetData[ids, :] = sourceData + coords[:, 0:1]
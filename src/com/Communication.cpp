@@ -1,6 +1,9 @@
 #include <algorithm>
 #include <memory>
 #include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "Communication.hpp"
@@ -11,6 +14,37 @@
 
 namespace precice::com {
 
+namespace {
+
+/// Number of items after which a broadcast is split into segments, which are forwarded along the tree in a pipeline
+constexpr std::size_t broadcastSegmentSize = 1 << 15;
+
+/// Returns the parent of the given rank in the binomial tree rooted at rank 0
+Rank treeParent(Rank rank)
+{
+  PRECICE_ASSERT(rank > 0, rank);
+  return rank & (rank - 1);
+}
+
+/// Returns the children of the given rank in the binomial tree rooted at rank 0, ordered by increasing subtree size
+std::vector<Rank> treeChildren(Rank rank, int size)
+{
+  std::vector<Rank> children;
+  for (Rank mask = 1; (mask < size) && ((rank & mask) == 0); mask <<= 1) {
+    if (rank + mask < size) {
+      children.push_back(rank + mask);
+    }
+  }
+  return children;
+}
+
+std::string treeNodeName(std::string const &participantName, Rank rank)
+{
+  return participantName + "Tree" + std::to_string(rank);
+}
+
+} // namespace
+
 void Communication::connectIntraComm(std::string const &participantName,
                                      std::string const &tag,
                                      int                rank,
@@ -34,6 +68,108 @@ void Communication::connectIntraComm(std::string const &participantName,
     PRECICE_INFO("Connecting Secondary rank #{} to Primary rank", secondaryRank);
     requestConnection(primaryName, secondaryName, tag, secondaryRank, secondaryRanksSize);
   }
+
+  connectTree(participantName, tag, rank, size);
+}
+
+void Communication::connectTree(std::string const &participantName,
+                                std::string const &tag,
+                                int                rank,
+                                int                size)
+{
+  PRECICE_ASSERT(not usesTree());
+
+  // With two ranks, the tree is the star of the primary rank
+  if ((size <= 2) || connectsAllRanks() || (createPeerCommunication() == nullptr)) {
+    return;
+  }
+
+  // Every rank first requests the connection to its parent, then accepts the connections of its children.
+  // Connections to the primary rank reuse this communication.
+  if ((rank != 0) && (treeParent(rank) != 0)) {
+    const Rank parent = treeParent(rank);
+    PRECICE_DEBUG("Connecting to parent rank {} of the tree", parent);
+    auto peer = createPeerCommunication();
+    peer->requestConnection(treeNodeName(participantName, parent), treeNodeName(participantName, rank), tag, 0, 1);
+    _treePeers.emplace(parent, std::move(peer));
+  }
+  if (rank != 0) {
+    for (Rank child : treeChildren(rank, size)) {
+      PRECICE_DEBUG("Connecting to child rank {} of the tree", child);
+      const auto acceptorName  = treeNodeName(participantName, rank);
+      const auto requesterName = treeNodeName(participantName, child);
+      auto       peer          = createPeerCommunication();
+      peer->prepareEstablishment(acceptorName, requesterName);
+      peer->acceptConnection(acceptorName, requesterName, tag, 0);
+      peer->cleanupEstablishment(acceptorName, requesterName);
+      _treePeers.emplace(child, std::move(peer));
+    }
+  }
+
+  _treeRank = rank;
+  _treeSize = size;
+}
+
+void Communication::closeTreeConnections()
+{
+  // Parents disconnect before children, which is required by the collective disconnect of MPI ports
+  for (auto &peer : _treePeers) {
+    peer.second->closeConnection();
+  }
+  _treePeers.clear();
+  _treeRank = -1;
+  _treeSize = 0;
+}
+
+std::pair<Communication *, Rank> Communication::treeLink(Rank rank)
+{
+  PRECICE_ASSERT(usesTree());
+  if ((_treeRank == 0) || (rank == 0)) {
+    return {this, rank};
+  }
+  PRECICE_ASSERT(_treePeers.count(rank) == 1, rank);
+  return {_treePeers.at(rank).get(), 0};
+}
+
+template <typename T>
+void Communication::treeReduceSum(precice::span<T> items)
+{
+  std::vector<T> received(items.size());
+  for (Rank child : treeChildren(_treeRank, _treeSize)) {
+    auto link = treeLink(child);
+    link.first->receive(precice::span<T>{received}, link.second);
+    for (size_t i = 0; i < items.size(); i++) {
+      items[i] += received[i];
+    }
+  }
+  if (_treeRank != 0) {
+    auto link = treeLink(treeParent(_treeRank));
+    link.first->send(precice::span<const T>{items}, link.second);
+  }
+}
+
+template <typename T>
+void Communication::treeBroadcast(precice::span<T> items)
+{
+  auto children = treeChildren(_treeRank, _treeSize);
+
+  // Segments are forwarded to the children while the next segment is received
+  std::vector<PtrRequest> requests;
+  for (std::size_t offset = 0; offset < items.size(); offset += broadcastSegmentSize) {
+    auto segment = items.subspan(offset, std::min(broadcastSegmentSize, items.size() - offset));
+    if constexpr (std::is_const_v<T>) {
+      PRECICE_ASSERT(_treeRank == 0);
+    } else if (_treeRank != 0) {
+      auto link = treeLink(treeParent(_treeRank));
+      link.first->receive(segment, link.second);
+    }
+    // The largest subtree takes the longest, hence, it is served first
+    for (auto child = children.rbegin(); child != children.rend(); ++child) {
+      auto link = treeLink(*child);
+      requests.push_back(link.first->aSend(precice::span<const std::remove_const_t<T>>{segment}, link.second));
+    }
+  }
+  Request::wait(requests);
 }
 
 /**
@@ -46,6 +182,11 @@ void Communication::reduceSum(precice::span<double const> itemsToSend, precice::
 
   std::copy(itemsToSend.begin(), itemsToSend.end(), itemsToReceive.begin());
 
+  if (usesTree()) {
+    treeReduceSum(itemsToReceive);
+    return;
+  }
+
   std::vector<double> received(itemsToReceive.size());
   // receive local results from secondary ranks
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -62,6 +203,13 @@ void Communication::reduceSum(precice::span<double const> itemsToSend, precice::
   PRECICE_TRACE(itemsToSend.size(), itemsToReceive.size());
   PRECICE_ASSERT(itemsToSend.size() == itemsToReceive.size());
 
+  if (usesTree()) {
+    PRECICE_ASSERT(primaryRank == 0, primaryRank);
+    std::vector<double> partialSum(itemsToSend.begin(), itemsToSend.end());
+    treeReduceSum(precice::span<double>{partialSum});
+    return;
+  }
+
   auto request = aSend(itemsToSend, primaryRank);
   request->wait();
 }
@@ -72,6 +220,11 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive)
 
   itemToReceive = itemToSend;
 
+  if (usesTree()) {
+    treeReduceSum(precice::span<int>{&itemToReceive, 1});
+    return;
+  }
+
   // receive local results from secondary ranks
   for (Rank rank : remoteCommunicatorRanks()) {
     auto request = aReceive(itemToSend, rank + _rankOffset);
@@ -84,6 +237,12 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive, Rank primaryRa
 {
   PRECICE_TRACE();
 
+  if (usesTree()) {
+    PRECICE_ASSERT(primaryRank == 0, primaryRank);
+    treeReduceSum(precice::span<int>{&itemToSend, 1});
+    return;
+  }
+
   auto request = aSend(itemToSend, primaryRank);
   request->wait();
 }
@@ -98,6 +257,11 @@ void Communication::allreduceSum(precice::span<double const> itemsToSend, precic
 
   reduceSum(itemsToSend, itemsToReceive);
 
+  if (usesTree()) {
+    treeBroadcast(itemsToReceive);
+    return;
+  }
+
   // send reduced result to all secondary ranks
   std::vector<PtrRequest> requests;
   requests.reserve(getRemoteCommunicatorSize());
@@ -115,6 +279,14 @@ void Communication::allreduceSum(precice::span<double const> itemsToSend, precic
   PRECICE_TRACE(itemsToSend.size(), itemsToReceive.size());
   PRECICE_ASSERT(itemsToSend.size() == itemsToReceive.size());
 
+  if (usesTree()) {
+    PRECICE_ASSERT(primaryRank == 0, primaryRank);
+    std::copy(itemsToSend.begin(), itemsToSend.end(), itemsToReceive.begin());
+    treeReduceSum(itemsToReceive);
+    treeBroadcast(itemsToReceive);
+    return;
+  }
+
   reduceSum(itemsToSend, itemsToReceive, primaryRank);
   // receive reduced data from primary rank
   receive(itemsToReceive, primaryRank + _rankOffset);
@@ -126,6 +298,12 @@ void Communication::allreduceSum(double itemToSend, double &itemToReceive)
 
   itemToReceive = itemToSend;
 
+  if (usesTree()) {
+    treeReduceSum(precice::span<double>{&itemToReceive, 1});
+    treeBroadcast(precice::span<double>{&itemToReceive, 1});
+    return;
+  }
+
   // receive local results from secondary ranks
   for (Rank rank : remoteCommunicatorRanks()) {
     auto request = aReceive(itemToSend, rank + _rankOffset);
@@ -146,6 +324,14 @@ void Communication::allreduceSum(double itemToSend, double &itemsToReceive, Rank
 {
   PRECICE_TRACE();
 
+  if (usesTree()) {
+    PRECICE_ASSERT(primaryRank == 0, primaryRank);
+    itemsToReceive = itemToSend;
+    treeReduceSum(precice::span<double>{&itemsToReceive, 1});
+    treeBroadcast(precice::span<double>{&itemsToReceive, 1});
+    return;
+  }
+
   auto request = aSend(itemToSend, primaryRank);
   request->wait();
   // receive reduced data from primary rank
@@ -158,6 +344,12 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive)
 
   itemToReceive = itemToSend;
 
+  if (usesTree()) {
+    treeReduceSum(precice::span<int>{&itemToReceive, 1});
+    treeBroadcast(precice::span<int>{&itemToReceive, 1});
+    return;
+  }
+
   // receive local results from secondary ranks
   for (Rank rank : remoteCommunicatorRanks()) {
     auto request = aReceive(itemToSend, rank + _rankOffset);
@@ -178,6 +370,14 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive, Rank primar
 {
   PRECICE_TRACE();
 
+  if (usesTree()) {
+    PRECICE_ASSERT(primaryRank == 0, primaryRank);
+    itemToReceive = itemToSend;
+    treeReduceSum(precice::span<int>{&itemToReceive, 1});
+    treeBroadcast(precice::span<int>{&itemToReceive, 1});
+    return;
+  }
+
   auto request = aSend(itemToSend, primaryRank);
   request->wait();
   // receive reduced data from primary rank
@@ -188,6 +388,11 @@ void Communication::broadcast(precice::span<const int> itemsToSend)
 {
   PRECICE_TRACE(itemsToSend.size());
 
+  if (usesTree()) {
+    treeBroadcast(itemsToSend);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -202,6 +407,12 @@ void Communication::broadcast(precice::span<int> itemsToReceive, Rank rankBroadc
 {
   PRECICE_TRACE(itemsToReceive.size());
 
+  if (usesTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    treeBroadcast(itemsToReceive);
+    return;
+  }
+
   receive(itemsToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -209,6 +420,11 @@ void Communication::broadcast(int itemToSend)
 {
   PRECICE_TRACE();
 
+  if (usesTree()) {
+    treeBroadcast(precice::span<const int>{&itemToSend, 1});
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -222,6 +438,12 @@ void Communication::broadcast(int itemToSend)
 void Communication::broadcast(int &itemToReceive, Rank rankBroadcaster)
 {
   PRECICE_TRACE();
+
+  if (usesTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    treeBroadcast(precice::span<int>{&itemToReceive, 1});
+    return;
+  }
   receive(itemToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -229,6 +451,11 @@ void Communication::broadcast(precice::span<const double> itemsToSend)
 {
   PRECICE_TRACE(itemsToSend.size());
 
+  if (usesTree()) {
+    treeBroadcast(itemsToSend);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -243,6 +470,12 @@ void Communication::broadcast(precice::span<double> itemsToReceive,
                               int                   rankBroadcaster)
 {
   PRECICE_TRACE(itemsToReceive.size());
+
+  if (usesTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    treeBroadcast(itemsToReceive);
+    return;
+  }
   receive(itemsToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -250,6 +483,11 @@ void Communication::broadcast(double itemToSend)
 {
   PRECICE_TRACE();
 
+  if (usesTree()) {
+    treeBroadcast(precice::span<const double>{&itemToSend, 1});
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -263,6 +501,12 @@ void Communication::broadcast(double itemToSend)
 void Communication::broadcast(double &itemToReceive, Rank rankBroadcaster)
 {
   PRECICE_TRACE();
+
+  if (usesTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    treeBroadcast(precice::span<double>{&itemToReceive, 1});
+    return;
+  }
   receive(itemToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <map>
 #include <set>
 #include <stddef.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "boost/range/irange.hpp"
@@ -81,6 +83,16 @@ public:
     return _isConnected;
   }
 
+  /**
+   * @brief Returns true, if all ranks of an intra-participant communication can communicate with each other.
+   *
+   * Otherwise, secondary ranks can only communicate with the primary rank.
+   */
+  virtual bool connectsAllRanks() const
+  {
+    return false;
+  }
+
   /**
    * @brief Returns the number of processes in the remote communicator.
    *
@@ -183,6 +195,10 @@ public:
                                          int                  requesterRank) = 0;
 
   /** Establishes the intra-participant communication connection.
+   *
+   * If the communication can create further connections, see createPeerCommunication(),
+   * all ranks are additionally connected in a binomial tree. Reductions and broadcasts then
+   * use this tree, which requires O(log(size)) steps instead of O(size) steps on the primary rank.
    *
    * @param[in] participantName Name of the calling participant.
    * @param[in] tag Tag for establishing this connection
@@ -380,8 +396,53 @@ protected:
   /// Adjusts the given rank bases on the _rankOffset
   virtual int adjustRank(Rank rank) const;
 
+  /**
+   * @brief Creates an unconnected communication of the same kind.
+   *
+   * Used by connectIntraComm() to connect secondary ranks with each other.
+   * Returns nullptr, if this is not supported.
+   */
+  virtual PtrCommunication createPeerCommunication() const
+  {
+    return nullptr;
+  }
+
+  /// Closes the connections to the neighbors in the tree used for collective operations
+  void closeTreeConnections();
+
 private:
   logging::Logger _log{"com::Communication"};
+
+  /// Rank of this process in the tree used for collective operations, -1 if there is no tree
+  Rank _treeRank = -1;
+
+  /// Number of ranks in the tree used for collective operations
+  int _treeSize = 0;
+
+  /// Connections to the neighbors in the tree, apart from the primary rank, which is reached via this communication
+  std::map<Rank, PtrCommunication> _treePeers;
+
+  /// Connects all ranks in a binomial tree rooted at the primary rank, if supported
+  void connectTree(std::string const &participantName,
+                   std::string const &tag,
+                   int                rank,
+                   int                size);
+
+  bool usesTree() const
+  {
+    return _treeRank >= 0;
+  }
+
+  /// Returns the communication and the rank to use to communicate with the given rank of the tree
+  std::pair<Communication *, Rank> treeLink(Rank rank);
+
+  /// Sums up the items of all ranks on the primary rank. The items of secondary ranks are overwritten by partial sums.
+  template <typename T>
+  void treeReduceSum(precice::span<T> items);
+
+  /// Broadcasts the items of the primary rank in segments, which are forwarded along the tree in a pipeline
+  template <typename T>
+  void treeBroadcast(precice::span<T> items);
 };
 
 /** Establishes a circular communication for the given participant.
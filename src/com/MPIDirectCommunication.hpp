@@ -41,6 +41,12 @@ public:
    */
   virtual size_t getRemoteCommunicatorSize() override;
 
+  /// All ranks share the same communicator, hence they can communicate with each other.
+  virtual bool connectsAllRanks() const override
+  {
+    return true;
+  }
+
   /** See precice::com::Communication::acceptConnection().
    * @attention Calls precice::utils::Parallel::splitCommunicator()
    * if local and global communicators are equal.
@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include <boost/filesystem.hpp>
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -224,6 +225,8 @@ void MPIPortsCommunication::closeConnection()
   if (not isConnected())
     return;
 
+  closeTreeConnections();
+
   for (auto &communicator : _communicators) {
     MPIResult res = MPI_Comm_disconnect(&communicator.second);
     if (!res) {
@@ -237,6 +240,11 @@ void MPIPortsCommunication::closeConnection()
   _isConnected = false;
 }
 
+PtrCommunication MPIPortsCommunication::createPeerCommunication() const
+{
+  return std::make_shared<MPIPortsCommunication>(_addressDirectory);
+}
+
 void MPIPortsCommunication::prepareEstablishment(std::string const &acceptorName,
                                                  std::string const &requesterName)
 {
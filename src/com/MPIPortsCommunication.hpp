@@ -59,6 +59,10 @@ public:
   virtual void cleanupEstablishment(std::string const &acceptorName,
                                     std::string const &requesterName) override;
 
+protected:
+  /// Creates an MPI ports communication using the same address directory
+  virtual PtrCommunication createPeerCommunication() const override;
+
 private:
   virtual MPI_Comm &communicator(Rank rank) override;
 
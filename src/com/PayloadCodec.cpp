@@ -0,0 +1,206 @@
+#include "com/PayloadCodec.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::com {
+
+namespace {
+
+logging::Logger _log("com::PayloadCodec");
+
+/// Describes the encoded words of a payload, occupies PayloadHeaderSize words
+struct Header {
+  /// Size of an encoded value in bytes, 8 or 4
+  std::uint8_t elementSize;
+  /// Whether the shuffled bytes are compressed
+  std::uint8_t packed;
+  std::uint8_t unused[2];
+  /// Number of encoded bytes following the header
+  std::uint32_t byteCount;
+  /// Number of encoded values
+  std::uint64_t valueCount;
+};
+
+static_assert(sizeof(Header) == PayloadHeaderSize * sizeof(double), "The header has to fill the header words.");
+
+/// Longest run and literal sequence a single control byte can describe
+constexpr std::size_t MaxRun = 128;
+
+/**
+ * Compresses bytes using a run-length encoding similar to PackBits.
+ *
+ * A control byte c < 128 is followed by c + 1 literal bytes.
+ * A control byte c >= 128 is followed by a byte, which is repeated c - 125 times.
+ * Returns false, if the compressed bytes would not be smaller than the input.
+ */
+bool pack(const std::vector<std::uint8_t> &in, std::vector<std::uint8_t> &out)
+{
+  out.clear();
+  out.reserve(in.size());
+  std::size_t i = 0;
+  while (i < in.size()) {
+    // Measure the run starting at i
+    std::size_t run = 1;
+    while (i + run < in.size() && run < MaxRun + 2 && in[i + run] == in[i]) {
+      ++run;
+    }
+    if (run >= 3) {
+      out.push_back(static_cast<std::uint8_t>(run + 125));
+      out.push_back(in[i]);
+      i += run;
+    } else {
+      // Collect literals until the next run of at least 3 bytes
+      std::size_t end = i;
+      while (end < in.size() && end - i < MaxRun &&
+             !(end + 2 < in.size() && in[end] == in[end + 1] && in[end] == in[end + 2])) {
+        ++end;
+      }
+      out.push_back(static_cast<std::uint8_t>(end - i - 1));
+      out.insert(out.end(), in.begin() + i, in.begin() + end);
+      i = end;
+    }
+    if (out.size() >= in.size()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void unpack(const std::uint8_t *in, std::size_t inSize, std::vector<std::uint8_t> &out)
+{
+  std::size_t i = 0;
+  while (i < inSize) {
+    const std::uint8_t control = in[i++];
+    if (control < MaxRun) {
+      PRECICE_CHECK(i + control + 1 <= inSize, "Received a corrupted payload.");
+      out.insert(out.end(), in + i, in + i + control + 1);
+      i += control + 1;
+    } else {
+      PRECICE_CHECK(i < inSize, "Received a corrupted payload.");
+      out.insert(out.end(), static_cast<std::size_t>(control - 125), in[i++]);
+    }
+  }
+}
+
+/// Groups the i-th bytes of all elements, which makes the slowly varying sign and exponent bytes compressible
+std::vector<std::uint8_t> shuffle(const std::uint8_t *bytes, std::size_t count, std::size_t elementSize)
+{
+  std::vector<std::uint8_t> shuffled(count * elementSize);
+  for (std::size_t e = 0; e < count; ++e) {
+    for (std::size_t b = 0; b < elementSize; ++b) {
+      shuffled[b * count + e] = bytes[e * elementSize + b];
+    }
+  }
+  return shuffled;
+}
+
+void unshuffle(const std::uint8_t *shuffled, std::size_t count, std::size_t elementSize, std::uint8_t *bytes)
+{
+  for (std::size_t e = 0; e < count; ++e) {
+    for (std::size_t b = 0; b < elementSize; ++b) {
+      bytes[e * elementSize + b] = shuffled[b * count + e];
+    }
+  }
+}
+
+std::size_t wordsFor(std::size_t bytes)
+{
+  return (bytes + sizeof(double) - 1) / sizeof(double);
+}
+
+} // namespace
+
+PayloadCodec payloadCodecFromString(const std::string &name)
+{
+  if (name == "none") {
+    return PayloadCodec::None;
+  }
+  if (name == "lossless") {
+    return PayloadCodec::Lossless;
+  }
+  PRECICE_ASSERT(name == "float32", name);
+  return PayloadCodec::Float32;
+}
+
+std::vector<double> encodePayload(PayloadCodec codec, precice::span<const double> values)
+{
+  Header header{};
+  header.valueCount = values.size();
+
+  std::vector<std::uint8_t> raw;
+  if (codec == PayloadCodec::Float32) {
+    header.elementSize = sizeof(float);
+    std::vector<float> rounded(values.begin(), values.end());
+    raw.resize(rounded.size() * sizeof(float));
+    std::memcpy(raw.data(), rounded.data(), raw.size());
+  } else {
+    header.elementSize = sizeof(double);
+    raw.resize(values.size() * sizeof(double));
+    std::memcpy(raw.data(), values.data(), raw.size());
+  }
+
+  std::vector<std::uint8_t> packed;
+  if (codec != PayloadCodec::None) {
+    auto shuffled = shuffle(raw.data(), values.size(), header.elementSize);
+    if (pack(shuffled, packed)) {
+      header.packed = 1;
+    }
+  }
+  const auto &encoded = header.packed ? packed : raw;
+  PRECICE_ASSERT(encoded.size() <= UINT32_MAX, encoded.size());
+  header.byteCount = encoded.size();
+
+  std::vector<double> payload(PayloadHeaderSize + wordsFor(encoded.size()), 0.0);
+  std::memcpy(payload.data(), &header, sizeof(Header));
+  std::memcpy(payload.data() + PayloadHeaderSize, encoded.data(), encoded.size());
+  return payload;
+}
+
+std::size_t payloadSize(precice::span<const double> header)
+{
+  PRECICE_ASSERT(header.size() >= PayloadHeaderSize, header.size());
+  Header h;
+  std::memcpy(&h, header.data(), sizeof(Header));
+  return wordsFor(h.byteCount);
+}
+
+void decodePayload(precice::span<const double> payload, precice::span<double> values)
+{
+  PRECICE_ASSERT(payload.size() >= PayloadHeaderSize, payload.size());
+  Header header;
+  std::memcpy(&header, payload.data(), sizeof(Header));
+  PRECICE_CHECK(header.valueCount == values.size(),
+                "Received a payload of {} values, but expected {} values. "
+                "Please make sure that both participants use the same compression.",
+                header.valueCount, values.size());
+  PRECICE_ASSERT(payload.size() == PayloadHeaderSize + wordsFor(header.byteCount), payload.size(), header.byteCount);
+
+  const auto *encoded = reinterpret_cast<const std::uint8_t *>(payload.data() + PayloadHeaderSize);
+
+  std::vector<std::uint8_t> raw;
+  if (header.packed) {
+    std::vector<std::uint8_t> shuffled;
+    shuffled.reserve(values.size() * header.elementSize);
+    unpack(encoded, header.byteCount, shuffled);
+    PRECICE_CHECK(shuffled.size() == values.size() * header.elementSize, "Received a corrupted payload.");
+    raw.resize(shuffled.size());
+    unshuffle(shuffled.data(), values.size(), header.elementSize, raw.data());
+  } else {
+    PRECICE_CHECK(header.byteCount == values.size() * header.elementSize, "Received a corrupted payload.");
+    raw.assign(encoded, encoded + header.byteCount);
+  }
+
+  if (header.elementSize == sizeof(float)) {
+    std::vector<float> rounded(values.size());
+    std::memcpy(rounded.data(), raw.data(), raw.size());
+    std::copy(rounded.begin(), rounded.end(), values.begin());
+  } else {
+    std::memcpy(values.data(), raw.data(), raw.size());
+  }
+}
+
+} // namespace precice::com
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "utils/span.hpp"
+
+namespace precice {
+namespace com {
+
+/// Codecs reducing the size of data payloads on the wire
+enum class PayloadCodec {
+  /// Transfers the values as they are
+  None,
+  /// Shuffles the bytes of the values and compresses runs of equal bytes
+  Lossless,
+  /// Rounds the values to single precision, which are then compressed losslessly
+  Float32
+};
+
+/// Returns the codec of the given name, which is one of "none", "lossless", and "float32"
+PayloadCodec payloadCodecFromString(const std::string &name);
+
+/// Number of words at the beginning of an encoded payload, which describe the remaining words
+constexpr std::size_t PayloadHeaderSize = 2;
+
+/**
+ * @brief Encodes the values into a payload of words, which starts with a header.
+ *
+ * If compressing does not reduce the size, the values are stored uncompressed.
+ * The header can be sent separately to let the receiver allocate the payload, see payloadSize().
+ */
+std::vector<double> encodePayload(PayloadCodec codec, precice::span<const double> values);
+
+/// Returns the number of words following the given header
+std::size_t payloadSize(precice::span<const double> header);
+
+/**
+ * @brief Decodes a payload created by encodePayload() into the given values.
+ *
+ * @param[in] payload the header followed by the encoded words
+ * @param[out] values the decoded values, whose size has to match the encoded ones
+ */
+void decodePayload(precice::span<const double> payload, precice::span<double> values);
+
+} // namespace com
+} // namespace precice
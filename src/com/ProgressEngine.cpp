@@ -0,0 +1,96 @@
+#include "com/ProgressEngine.hpp"
+#include <utility>
+#include "com/Request.hpp"
+
+namespace precice::com {
+
+/// Tracks the completion of an item, which is signaled by the engine thread
+class ProgressEngine::CompletionRequest : public Request {
+public:
+  void complete()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _complete = true;
+    }
+    _completeCondition.notify_all();
+  }
+
+  bool test() override
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _complete;
+  }
+
+  void wait() override
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _completeCondition.wait(lock, [this] { return _complete; });
+  }
+
+private:
+  bool                    _complete = false;
+  std::mutex              _mutex;
+  std::condition_variable _completeCondition;
+};
+
+ProgressEngine::ProgressEngine()
+    : _thread([this] { run(); })
+{
+}
+
+ProgressEngine::~ProgressEngine()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _addedOrStopped.notify_one();
+  _thread.join();
+}
+
+PtrRequest ProgressEngine::add(PtrRequest request, Callback onCompletion)
+{
+  auto completion = std::make_shared<CompletionRequest>();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _added.push_back({std::move(request), std::move(onCompletion), completion});
+  }
+  _addedOrStopped.notify_one();
+  return completion;
+}
+
+void ProgressEngine::run()
+{
+  std::list<Item> pending;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (pending.empty()) {
+        _addedOrStopped.wait(lock, [this] { return _stop || !_added.empty(); });
+        if (_added.empty()) {
+          return; // Stopped and nothing left to do
+        }
+      }
+      pending.splice(pending.end(), _added);
+    }
+
+    for (auto it = pending.begin(); it != pending.end();) {
+      if (it->request->test()) {
+        if (it->onCompletion) {
+          it->onCompletion();
+        }
+        it->completion->complete();
+        it = pending.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    if (!pending.empty()) {
+      std::this_thread::yield(); // give up our time slice, so others may work
+    }
+  }
+}
+
+} // namespace precice::com
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "com/SharedPointer.hpp"
+
+namespace precice {
+namespace com {
+
+/**
+ * @brief Drives asynchronous requests to completion in a background thread.
+ *
+ * Requests such as MPIRequest only make progress, while they are tested or waited for.
+ * The engine tests all added requests in a dedicated thread, such that large messages
+ * are transferred while the solver computes.
+ *
+ * Requests added to the engine must only be accessed by the engine afterwards.
+ * The request returned by add() tracks the completion instead.
+ *
+ * @attention Testing MPI requests in the background requires MPI_THREAD_MULTIPLE.
+ */
+class ProgressEngine {
+public:
+  using Callback = std::function<void()>;
+
+  ProgressEngine();
+
+  /// Completes all added requests and stops the thread
+  ~ProgressEngine();
+
+  ProgressEngine(ProgressEngine const &) = delete;
+  ProgressEngine &operator=(ProgressEngine const &) = delete;
+
+  /**
+   * @brief Hands the request over to the engine.
+   *
+   * @param[in] request the request to drive to completion
+   * @param[in] onCompletion is called by the engine thread after the request completed
+   *
+   * @return a request, which completes after onCompletion returned
+   */
+  PtrRequest add(PtrRequest request, Callback onCompletion = {});
+
+private:
+  class CompletionRequest;
+
+  struct Item {
+    PtrRequest                         request;
+    Callback                           onCompletion;
+    std::shared_ptr<CompletionRequest> completion;
+  };
+
+  /// Tests the items until the engine is stopped and all items are completed
+  void run();
+
+  /// Items added, but not yet picked up by the thread
+  std::list<Item> _added;
+
+  std::mutex _mutex;
+
+  std::condition_variable _addedOrStopped;
+
+  bool _stop = false;
+
+  std::thread _thread;
+};
+
+} // namespace com
+} // namespace precice
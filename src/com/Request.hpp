@@ -16,5 +16,13 @@ public:
 
   virtual void wait() = 0;
 };
+
+/// Request of an operation, which completed before the request was created
+class CompletedRequest : public Request {
+public:
+  bool test() override;
+
+  void wait() override;
+};
 } // namespace com
 } // namespace precice
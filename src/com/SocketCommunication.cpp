@@ -319,6 +319,8 @@ void SocketCommunication::closeConnection()
   if (not isConnected())
     return;
 
+  closeTreeConnections();
+
   if (_thread.joinable()) {
     _work.reset();
     _ioService->stop();
@@ -339,6 +341,11 @@ void SocketCommunication::closeConnection()
   _isConnected = false;
 }
 
+PtrCommunication SocketCommunication::createPeerCommunication() const
+{
+  return std::make_shared<SocketCommunication>(0, false, _networkName, _addressDirectory);
+}
+
 void SocketCommunication::send(std::string const &itemToSend, Rank rankReceiver)
 {
   PRECICE_TRACE(itemToSend, rankReceiver);
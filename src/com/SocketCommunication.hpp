@@ -127,6 +127,10 @@ public:
   virtual void cleanupEstablishment(std::string const &acceptorName,
                                     std::string const &requesterName) override;
 
+protected:
+  /// Creates a socket communication on the same network using any free port
+  virtual PtrCommunication createPeerCommunication() const override;
+
 private:
   logging::Logger _log{"com::SocketCommunication"};
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -787,6 +789,82 @@ void TestReduceVectors(TestContext const &context)
   }
 }
 
+/// Tests reductions and broadcasts on an intra-participant communication connected by connectIntraComm()
+template <typename T>
+void TestCollectivesIntraComm(TestContext const &context)
+{
+  T com;
+  com.connectIntraComm("Collectives", "", context.rank, context.size);
+
+  // Larger than a segment of a broadcast
+  const int    n   = 100000;
+  const double sum = context.size * (context.size + 1) / 2;
+  {
+    std::vector<double> msg(n, context.rank + 1.0);
+    std::vector<double> rcv(n, 0.0);
+    if (context.isPrimary()) {
+      com.allreduceSum(msg, rcv);
+    } else {
+      com.allreduceSum(msg, rcv, 0);
+    }
+    BOOST_TEST(std::all_of(rcv.begin(), rcv.end(), [sum](double v) { return v == sum; }));
+  }
+  {
+    std::vector<double> msg{context.rank + 1.0, 2.0};
+    std::vector<double> rcv{0.0, 0.0};
+    if (context.isPrimary()) {
+      com.reduceSum(msg, rcv);
+      BOOST_TEST(rcv[0] == sum);
+      BOOST_TEST(rcv[1] == 2.0 * context.size);
+    } else {
+      com.reduceSum(msg, rcv, 0);
+    }
+  }
+  {
+    int    rcv  = 0;
+    double drcv = 0.0;
+    if (context.isPrimary()) {
+      com.reduceSum(context.rank + 1, rcv);
+      BOOST_TEST(rcv == sum);
+      com.allreduceSum(context.rank + 1.0, drcv);
+      com.allreduceSum(context.rank + 1, rcv);
+    } else {
+      com.reduceSum(context.rank + 1, rcv, 0);
+      com.allreduceSum(context.rank + 1.0, drcv, 0);
+      com.allreduceSum(context.rank + 1, rcv, 0);
+    }
+    BOOST_TEST(drcv == sum);
+    BOOST_TEST(rcv == sum);
+  }
+  {
+    std::vector<double> v(n);
+    std::vector<int>    iv;
+    int                 i = 0;
+    if (context.isPrimary()) {
+      std::iota(v.begin(), v.end(), 0.0);
+      iv = {1, 2, 3};
+      i  = 42;
+      com.broadcast(v);
+      com.broadcast(iv);
+      com.broadcast(i);
+      com.broadcast(true);
+    } else {
+      bool b = false;
+      v.clear();
+      com.broadcast(v, 0);
+      com.broadcast(iv, 0);
+      com.broadcast(i, 0);
+      com.broadcast(b, 0);
+      BOOST_TEST(b);
+    }
+    BOOST_TEST(v.size() == n);
+    BOOST_TEST(v.back() == n - 1.0);
+    BOOST_TEST(iv == std::vector<int>({1, 2, 3}), boost::test_tools::per_element());
+    BOOST_TEST(i == 42);
+  }
+  com.closeConnection();
+}
+
 } // namespace intracomm
 
 namespace serverclient {
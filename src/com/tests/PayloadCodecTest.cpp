@@ -0,0 +1,91 @@
+#include <cmath>
+#include <vector>
+#include "com/PayloadCodec.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+namespace {
+
+/// Smooth data as it is typically exchanged
+std::vector<double> smoothValues(int size)
+{
+  std::vector<double> values(size);
+  for (int i = 0; i < size; ++i) {
+    values[i] = 1.0 + 0.1 * std::sin(0.01 * i);
+  }
+  return values;
+}
+
+std::vector<double> roundTrip(PayloadCodec codec, const std::vector<double> &values)
+{
+  auto payload = encodePayload(codec, values);
+  BOOST_TEST(payload.size() == PayloadHeaderSize + payloadSize(payload));
+  std::vector<double> decoded(values.size(), -1.0);
+  decodePayload(payload, decoded);
+  return decoded;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+BOOST_AUTO_TEST_SUITE(PayloadCodecTests)
+
+BOOST_AUTO_TEST_CASE(None)
+{
+  PRECICE_TEST(1_rank);
+  auto values  = smoothValues(1000);
+  auto payload = encodePayload(PayloadCodec::None, values);
+  BOOST_TEST(payload.size() == PayloadHeaderSize + values.size());
+  BOOST_TEST(roundTrip(PayloadCodec::None, values) == values, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Lossless)
+{
+  PRECICE_TEST(1_rank);
+  auto values = smoothValues(1000);
+  BOOST_TEST(roundTrip(PayloadCodec::Lossless, values) == values, boost::test_tools::per_element());
+
+  // Constant data compresses well
+  std::vector<double> constant(1000, 2.5);
+  BOOST_TEST(encodePayload(PayloadCodec::Lossless, constant).size() < 20);
+  BOOST_TEST(roundTrip(PayloadCodec::Lossless, constant) == constant, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Float32)
+{
+  PRECICE_TEST(1_rank);
+  auto values  = smoothValues(1000);
+  auto payload = encodePayload(PayloadCodec::Float32, values);
+  BOOST_TEST(payload.size() <= PayloadHeaderSize + values.size() / 2);
+
+  auto decoded = roundTrip(PayloadCodec::Float32, values);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    BOOST_TEST(decoded[i] == values[i], boost::test_tools::tolerance(1e-7));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Incompressible)
+{
+  PRECICE_TEST(1_rank);
+  // Values without equal bytes are stored uncompressed
+  std::vector<double> values{1.0 / 3.0, -7e12, 42.0};
+  auto                payload = encodePayload(PayloadCodec::Lossless, values);
+  BOOST_TEST(payload.size() <= PayloadHeaderSize + values.size());
+  BOOST_TEST(roundTrip(PayloadCodec::Lossless, values) == values, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PRECICE_TEST(1_rank);
+  std::vector<double> values;
+  for (auto codec : {PayloadCodec::None, PayloadCodec::Lossless, PayloadCodec::Float32}) {
+    BOOST_TEST(encodePayload(codec, values).size() == PayloadHeaderSize);
+    BOOST_TEST(roundTrip(codec, values).empty());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PayloadCodecTests
+BOOST_AUTO_TEST_SUITE_END() // CommunicationTests
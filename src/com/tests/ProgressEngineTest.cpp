@@ -0,0 +1,59 @@
+#include <memory>
+#include <thread>
+#include <vector>
+#include "com/ProgressEngine.hpp"
+#include "com/SharedPointer.hpp"
+#include "com/SocketRequest.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+BOOST_AUTO_TEST_SUITE(ProgressEngineTests)
+
+BOOST_AUTO_TEST_CASE(CompletesRequests)
+{
+  PRECICE_TEST(1_rank);
+  std::vector<std::shared_ptr<SocketRequest>> requests;
+  std::vector<PtrRequest>                     completions;
+  std::vector<int>                            called(3, 0);
+  {
+    ProgressEngine engine;
+    for (int i = 0; i < 3; ++i) {
+      requests.push_back(std::make_shared<SocketRequest>());
+      completions.push_back(engine.add(requests.back(), [&called, i] { ++called[i]; }));
+    }
+    BOOST_TEST(!completions[1]->test());
+
+    // Requests complete in a different order than they were added
+    std::thread completer([&requests] {
+      requests[1]->complete();
+      requests[2]->complete();
+      requests[0]->complete();
+    });
+    completions[1]->wait();
+    BOOST_TEST(called[1] == 1);
+    completer.join();
+  }
+  // The engine completes all requests before it stops
+  for (int i = 0; i < 3; ++i) {
+    BOOST_TEST(completions[i]->test());
+    BOOST_TEST(called[i] == 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WithoutCallback)
+{
+  PRECICE_TEST(1_rank);
+  ProgressEngine engine;
+  auto           request = std::make_shared<SocketRequest>();
+  request->complete();
+  auto completion = engine.add(request);
+  completion->wait();
+  BOOST_TEST(completion->test());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ProgressEngineTests
+BOOST_AUTO_TEST_SUITE_END() // CommunicationTests
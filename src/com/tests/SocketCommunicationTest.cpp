@@ -66,6 +66,13 @@ BOOST_AUTO_TEST_CASE(ReduceVectors)
   TestReduceVectors<SocketCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(CollectivesFourRanks)
+{
+  PRECICE_TEST(4_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestCollectivesIntraComm<SocketCommunication>(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Intra
 
 BOOST_AUTO_TEST_SUITE(Inter)
@@ -13,6 +13,8 @@
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "impl/ConvergenceMeasure.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "io/TXTTableWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "math/differences.hpp"
@@ -21,6 +23,7 @@
 #include "precice/types.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 
 namespace precice::cplscheme {
 
@@ -80,14 +83,26 @@ BaseCouplingScheme::BaseCouplingScheme(
 
 void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendData)
 {
-  PRECICE_TRACE();
+  this->sendData(m2n, sendData, {});
+}
+
+void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendData, precice::span<double const> header)
+{
+  PRECICE_TRACE(header.size());
   std::vector<int> sentDataIDs;
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
 
+  if (sendData.empty()) {
+    for (double value : header) {
+      m2n->send(value);
+    }
+  }
+
   for (const DataMap::value_type &pair : sendData) {
     // Data is actually only send if size>0, which is checked in the derived classes implementation
-    m2n->send(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
+    // The control values are attached to the first data only
+    m2n->send(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions(), sentDataIDs.empty() ? header : precice::span<double const>{});
 
     if (pair.second->hasGradient()) {
       m2n->send(pair.second->gradientValues(), pair.second->getMeshID(), pair.second->getDimensions() * pair.second->meshDimensions());
@@ -100,13 +115,25 @@ void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendDat
 
 void BaseCouplingScheme::receiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData)
 {
-  PRECICE_TRACE();
+  this->receiveData(m2n, receiveData, {});
+}
+
+void BaseCouplingScheme::receiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData, precice::span<double> header)
+{
+  PRECICE_TRACE(header.size());
   std::vector<int> receivedDataIDs;
   PRECICE_ASSERT(m2n.get());
   PRECICE_ASSERT(m2n->isConnected());
+
+  if (receiveData.empty()) {
+    for (double &value : header) {
+      m2n->receive(value);
+    }
+  }
+
   for (const DataMap::value_type &pair : receiveData) {
     // Data is only received on ranks with size>0, which is checked in the derived class implementation
-    m2n->receive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
+    m2n->receive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions(), receivedDataIDs.empty() ? header : precice::span<double>{});
 
     if (pair.second->hasGradient()) {
       m2n->receive(pair.second->gradientValues(), pair.second->getMeshID(), pair.second->getDimensions() * pair.second->meshDimensions());
@@ -117,6 +144,22 @@ void BaseCouplingScheme::receiveData(const m2n::PtrM2N &m2n, const DataMap &rece
   PRECICE_DEBUG("Number of received data sets = {}", receivedDataIDs.size());
 }
 
+void BaseCouplingScheme::aReceiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData, std::vector<com::PtrRequest> &requests)
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(m2n.get());
+  PRECICE_ASSERT(m2n->isConnected());
+
+  for (const DataMap::value_type &pair : receiveData) {
+    requests.push_back(m2n->aReceive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions()));
+
+    if (pair.second->hasGradient()) {
+      requests.push_back(m2n->aReceive(pair.second->gradientValues(), pair.second->getMeshID(), pair.second->getDimensions() * pair.second->meshDimensions()));
+    }
+  }
+  PRECICE_DEBUG("Number of posted receives = {}", requests.size());
+}
+
 void BaseCouplingScheme::setTimeWindowSize(double timeWindowSize)
 {
   _timeWindowSize = timeWindowSize;
@@ -412,6 +455,36 @@ std::string BaseCouplingScheme::printCouplingState() const
   return os.str();
 }
 
+void BaseCouplingScheme::exportState(io::CheckpointWriter &writer)
+{
+  PRECICE_TRACE(_timeWindows, _time);
+  PRECICE_ASSERT(_isInitialized);
+  writer.writeTag("CouplingScheme");
+  writer.write(_timeWindowSize);
+  writer.write(_totalIterations);
+  for (const DataMap::value_type &pair : getAllData()) {
+    pair.second->exportState(writer);
+  }
+  if (_acceleration) {
+    _acceleration->exportState(writer);
+  }
+}
+
+void BaseCouplingScheme::importState(io::CheckpointReader &reader)
+{
+  PRECICE_TRACE(_timeWindows, _time);
+  PRECICE_ASSERT(_isInitialized);
+  reader.readTag("CouplingScheme");
+  reader.read(_timeWindowSize);
+  reader.read(_totalIterations);
+  for (const DataMap::value_type &pair : getAllData()) {
+    pair.second->importState(reader, not _hasDataBeenReceived);
+  }
+  if (_acceleration) {
+    _acceleration->importState(reader);
+  }
+}
+
 std::string BaseCouplingScheme::printBasicState(
     int    timeWindows,
     double time) const
@@ -521,11 +594,18 @@ bool BaseCouplingScheme::measureConvergence()
     _convergenceWriter->writeData("TimeWindow", _timeWindows - 1);
     _convergenceWriter->writeData("Iteration", _iterations);
   }
+
+  // All measures share a single global reduction
+  utils::ReductionBatch sums;
   for (const auto &convMeasure : _convergenceMeasures) {
     PRECICE_ASSERT(convMeasure.couplingData != nullptr);
     PRECICE_ASSERT(convMeasure.measure.get() != nullptr);
+    convMeasure.measure->addPartialSums(convMeasure.couplingData->previousIteration(), convMeasure.couplingData->values(), sums);
+  }
+  sums.allreduceSum();
 
-    convMeasure.measure->measure(convMeasure.couplingData->previousIteration(), convMeasure.couplingData->values());
+  for (const auto &convMeasure : _convergenceMeasures) {
+    convMeasure.measure->evaluate(sums);
 
     if (not utils::IntraComm::isSecondary() && convMeasure.doesLogging) {
       _convergenceWriter->writeData(convMeasure.logHeader(), convMeasure.measure->getNormResidual());
@@ -691,4 +771,19 @@ bool BaseCouplingScheme::receiveConvergence(const m2n::PtrM2N &m2n)
   return convergence;
 }
 
+void BaseCouplingScheme::sendDataAndConvergence(const m2n::PtrM2N &m2n, const DataMap &sendData, bool convergence)
+{
+  PRECICE_ASSERT(not doesFirstStep(), "For convergence information the sending participant is never the first one.");
+  const double header = convergence ? 1.0 : 0.0;
+  this->sendData(m2n, sendData, {&header, 1});
+}
+
+bool BaseCouplingScheme::receiveDataAndConvergence(const m2n::PtrM2N &m2n, const DataMap &receiveData)
+{
+  PRECICE_ASSERT(doesFirstStep(), "For convergence information the receiving participant is always the first one.");
+  double header = 0.0;
+  this->receiveData(m2n, receiveData, {&header, 1});
+  return header != 0.0;
+}
+
 } // namespace precice::cplscheme
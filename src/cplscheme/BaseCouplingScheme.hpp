@@ -199,6 +199,16 @@ public:
    */
   std::string printCouplingState() const override;
 
+  /// Exports the time window size, the iteration count, all coupling data, and the acceleration.
+  void exportState(io::CheckpointWriter &writer) override final;
+
+  /**
+   * @brief Imports the state written by exportState().
+   *
+   * Values received during initialize() are kept, all other values are restored.
+   */
+  void importState(io::CheckpointReader &reader) override final;
+
   /// Finalizes the coupling scheme.
   void finalize() override final;
 
@@ -258,6 +268,23 @@ protected:
   /// Receives data receiveDataIDs given in mapCouplingData with communication.
   void receiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData);
 
+  /**
+   * @brief Sends data like sendData(m2n, sendData) and attaches the given control values to the first data.
+   *
+   * Without any data to send, the control values are sent on their own.
+   */
+  void sendData(const m2n::PtrM2N &m2n, const DataMap &sendData, precice::span<double const> header);
+
+  /// Receives data like receiveData(m2n, receiveData) and the control values attached by sendData(m2n, sendData, header)
+  void receiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData, precice::span<double> header);
+
+  /**
+   * @brief Posts the receives of the data like receiveData(m2n, receiveData) without waiting for the data.
+   *
+   * @param[out] requests the requests of the receives are appended, the data must not be accessed before they completed
+   */
+  void aReceiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData, std::vector<com::PtrRequest> &requests);
+
   /**
    * @brief interface to provide all CouplingData, depending on coupling scheme being used
    * @return DataMap containing all CouplingData
@@ -349,6 +376,22 @@ protected:
    */
   bool receiveConvergence(const m2n::PtrM2N &m2n);
 
+  /**
+   * @brief sends data and the convergence attached to it to the other participant via m2n
+   * @param m2n used for sending
+   * @param sendData data being sent
+   * @param convergence bool that is being sent
+   */
+  void sendDataAndConvergence(const m2n::PtrM2N &m2n, const DataMap &sendData, bool convergence);
+
+  /**
+   * @brief receives data and the convergence attached to it from the other participant via m2n
+   * @param m2n used for receiving
+   * @param receiveData data being received
+   * @returns convergence bool
+   */
+  bool receiveDataAndConvergence(const m2n::PtrM2N &m2n, const DataMap &receiveData);
+
   /**
    * @brief perform a coupling iteration
    * @returns whether this iteration has converged or not
@@ -313,6 +313,22 @@ std::string CompositionalCouplingScheme::printCouplingState() const
   return state;
 }
 
+void CompositionalCouplingScheme::exportState(io::CheckpointWriter &writer)
+{
+  PRECICE_TRACE();
+  for (const Scheme &scheme : _couplingSchemes) {
+    scheme.scheme->exportState(writer);
+  }
+}
+
+void CompositionalCouplingScheme::importState(io::CheckpointReader &reader)
+{
+  PRECICE_TRACE();
+  for (const Scheme &scheme : _couplingSchemes) {
+    scheme.scheme->importState(reader);
+  }
+}
+
 bool CompositionalCouplingScheme::determineActiveCouplingSchemes()
 {
   PRECICE_TRACE();
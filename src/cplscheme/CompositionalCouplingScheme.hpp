@@ -224,6 +224,12 @@ public:
   /// Returns a string representation of the current coupling state.
   std::string printCouplingState() const final override;
 
+  /// Exports the states of all coupling schemes in the order they were added.
+  void exportState(io::CheckpointWriter &writer) final override;
+
+  /// Imports the states of all coupling schemes in the order they were added.
+  void importState(io::CheckpointReader &reader) final override;
+
 private:
   mutable logging::Logger _log{"cplscheme::CompositionalCouplingScheme"};
 
@@ -2,6 +2,9 @@
 
 #include <utility>
 
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
+#include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -112,4 +115,28 @@ void CouplingData::storeExtrapolationData()
   _extrapolation.store(values());
 }
 
+void CouplingData::exportState(io::CheckpointWriter &writer) const
+{
+  writer.writeTag("CouplingData");
+  writer.write(values());
+  writer.write(_previousIteration);
+  _extrapolation.exportState(writer);
+}
+
+void CouplingData::importState(io::CheckpointReader &reader, bool restoreValues)
+{
+  reader.readTag("CouplingData");
+  Eigen::VectorXd stored;
+  reader.read(stored);
+  PRECICE_CHECK(stored.size() == values().size(),
+                "The checkpoint contains {} values of the data \"{}\", but {} values are required. "
+                "Please restart with the number of ranks of the run, which wrote the checkpoint.",
+                stored.size(), _data->getName(), values().size());
+  if (restoreValues) {
+    values() = stored;
+  }
+  reader.read(_previousIteration);
+  _extrapolation.importState(reader);
+}
+
 } // namespace precice::cplscheme
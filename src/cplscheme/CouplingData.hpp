@@ -4,10 +4,16 @@
 #include <vector>
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/impl/Extrapolation.hpp"
+#include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
+namespace io {
+class CheckpointReader;
+class CheckpointWriter;
+} // namespace io
+
 namespace cplscheme {
 
 class CouplingData {
@@ -68,7 +74,19 @@ public:
   /// store current value in _extrapolation
   void storeExtrapolationData();
 
+  /// Writes the values, the values of the previous iteration, and the extrapolation to a checkpoint
+  void exportState(io::CheckpointWriter &writer) const;
+
+  /**
+   * @brief Reads the state written by exportState(), the extrapolation needs to be initialized.
+   *
+   * @param[in] restoreValues Overwrite the current values, false keeps data received during initialization.
+   */
+  void importState(io::CheckpointReader &reader, bool restoreValues);
+
 private:
+  mutable logging::Logger _log{"cplscheme::CouplingData"};
+
   /**
    * @brief Default constructor, not to be used!
    *
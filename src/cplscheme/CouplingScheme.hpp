@@ -5,6 +5,13 @@
 #include <vector>
 #include "com/SharedPointer.hpp"
 
+namespace precice {
+namespace io {
+class CheckpointReader;
+class CheckpointWriter;
+} // namespace io
+} // namespace precice
+
 namespace precice {
 namespace cplscheme {
 
@@ -186,6 +193,12 @@ public:
 
   /// Returns a string representation of the current coupling state.
   virtual std::string printCouplingState() const = 0;
+
+  /// Writes the state required to restart the coupling at the current time window.
+  virtual void exportState(io::CheckpointWriter &writer) = 0;
+
+  /// Restores the state written by exportState(), has to be called after initialize().
+  virtual void importState(io::CheckpointReader &reader) = 0;
 };
 
 } // namespace cplscheme
@@ -6,8 +6,11 @@
 #include <ostream>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/SharedPointer.hpp"
+#include "com/Request.hpp"
+#include "com/SharedPointer.hpp"
 #include "cplscheme/BaseCouplingScheme.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
@@ -106,29 +109,36 @@ bool MultiCouplingScheme::exchangeDataAndAccelerate()
   bool convergence = true;
 
   if (_isController) {
+    // Receive from all participants at once, such that the slowest participant does not delay the others
+    std::vector<com::PtrRequest> requests;
     for (auto &receiveExchange : _receiveDataVector) {
-      receiveData(_m2ns[receiveExchange.first], receiveExchange.second);
+      aReceiveData(_m2ns[receiveExchange.first], receiveExchange.second, requests);
     }
+    com::Request::wait(requests);
     checkDataHasBeenReceived();
 
     convergence = doImplicitStep();
-    for (const auto &m2nPair : _m2ns) {
-      sendConvergence(m2nPair.second, convergence);
-    }
 
-    for (auto &sendExchange : _sendDataVector) {
-      sendData(_m2ns[sendExchange.first], sendExchange.second);
+    // The convergence is attached to the data sent to each participant
+    for (const auto &m2nPair : _m2ns) {
+      const auto sendExchange = _sendDataVector.find(m2nPair.first);
+      sendDataAndConvergence(m2nPair.second, sendExchange != _sendDataVector.end() ? sendExchange->second : DataMap{}, convergence);
     }
   } else {
     for (auto &sendExchange : _sendDataVector) {
       sendData(_m2ns[sendExchange.first], sendExchange.second);
     }
 
-    convergence = receiveConvergence(_m2ns[_controller]);
+    const auto controllerExchange = _receiveDataVector.find(_controller);
+    convergence                   = receiveDataAndConvergence(_m2ns[_controller], controllerExchange != _receiveDataVector.end() ? controllerExchange->second : DataMap{});
 
+    std::vector<com::PtrRequest> requests;
     for (auto &receiveExchange : _receiveDataVector) {
-      receiveData(_m2ns[receiveExchange.first], receiveExchange.second);
+      if (receiveExchange.first != _controller) {
+        aReceiveData(_m2ns[receiveExchange.first], receiveExchange.second, requests);
+      }
     }
+    com::Request::wait(requests);
     checkDataHasBeenReceived();
   }
   return convergence;
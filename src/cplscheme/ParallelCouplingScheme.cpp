@@ -60,9 +60,10 @@ bool ParallelCouplingScheme::exchangeDataAndAccelerate()
     sendData(getM2N(), getSendData());
     PRECICE_DEBUG("Receiving data...");
     if (isImplicitCouplingScheme()) {
-      convergence = receiveConvergence(getM2N());
+      convergence = receiveDataAndConvergence(getM2N(), getReceiveData());
+    } else {
+      receiveData(getM2N(), getReceiveData());
     }
-    receiveData(getM2N(), getReceiveData());
     checkDataHasBeenReceived();
   } else { //second participant
     PRECICE_DEBUG("Receiving data...");
@@ -71,10 +72,12 @@ bool ParallelCouplingScheme::exchangeDataAndAccelerate()
     if (isImplicitCouplingScheme()) {
       PRECICE_DEBUG("Perform acceleration (only second participant)...");
       convergence = doImplicitStep();
-      sendConvergence(getM2N(), convergence);
+      PRECICE_DEBUG("Sending data...");
+      sendDataAndConvergence(getM2N(), getSendData(), convergence);
+    } else {
+      PRECICE_DEBUG("Sending data...");
+      sendData(getM2N(), getSendData());
     }
-    PRECICE_DEBUG("Sending data...");
-    sendData(getM2N(), getSendData());
   }
 
   return convergence;
@@ -52,26 +52,31 @@ void SerialCouplingScheme::setTimeWindowSize(double timeWindowSize)
   BaseCouplingScheme::setTimeWindowSize(timeWindowSize);
 }
 
-void SerialCouplingScheme::sendTimeWindowSize()
+void SerialCouplingScheme::sendDataAndTimeWindowSize()
 {
   PRECICE_TRACE();
   if (_participantSetsTimeWindowSize) {
-    PRECICE_DEBUG("sending time window size of {}", getComputedTimeWindowPart());
-    getM2N()->send(getComputedTimeWindowPart());
+    const double dt = getComputedTimeWindowPart();
+    PRECICE_DEBUG("sending time window size of {}", dt);
+    sendData(getM2N(), getSendData(), {&dt, 1});
+  } else {
+    sendData(getM2N(), getSendData());
   }
 }
 
-void SerialCouplingScheme::receiveAndSetTimeWindowSize()
+void SerialCouplingScheme::receiveDataAndSetTimeWindowSize()
 {
   PRECICE_TRACE();
   if (_participantReceivesTimeWindowSize) {
     double dt = UNDEFINED_TIME_WINDOW_SIZE;
-    getM2N()->receive(dt);
+    receiveData(getM2N(), getReceiveData(), {&dt, 1});
     PRECICE_DEBUG("Received time window size of {}.", dt);
     PRECICE_ASSERT(not _participantSetsTimeWindowSize);
     PRECICE_ASSERT(not math::equals(dt, UNDEFINED_TIME_WINDOW_SIZE));
     PRECICE_ASSERT(not doesFirstStep(), "Only second participant can receive time window size.");
     setTimeWindowSize(dt);
+  } else {
+    receiveData(getM2N(), getReceiveData());
   }
 }
 
@@ -84,9 +89,8 @@ void SerialCouplingScheme::initializeImplementation()
   // If the second participant initializes data, the first receive for the
   // second participant is done in initializeData() instead of initialize().
   if (not doesFirstStep() && not sendsInitializedData() && isCouplingOngoing()) {
-    receiveAndSetTimeWindowSize();
     PRECICE_DEBUG("Receiving data");
-    receiveData(getM2N(), getReceiveData());
+    receiveDataAndSetTimeWindowSize();
     checkDataHasBeenReceived();
   }
 }
@@ -105,9 +109,8 @@ void SerialCouplingScheme::exchangeInitialData()
       // The second participant sends the initialized data to the first participant
       // here, which receives the data on call of initialize().
       sendData(getM2N(), getSendData());
-      receiveAndSetTimeWindowSize();
       // This receive replaces the receive in initialize().
-      receiveData(getM2N(), getReceiveData());
+      receiveDataAndSetTimeWindowSize();
       checkDataHasBeenReceived();
     }
   }
@@ -119,27 +122,28 @@ bool SerialCouplingScheme::exchangeDataAndAccelerate()
 
   if (doesFirstStep()) { // first participant
     PRECICE_DEBUG("Sending data...");
-    sendTimeWindowSize();
-    sendData(getM2N(), getSendData());
+    sendDataAndTimeWindowSize();
+    PRECICE_DEBUG("Receiving data...");
     if (isImplicitCouplingScheme()) {
-      convergence = receiveConvergence(getM2N());
+      convergence = receiveDataAndConvergence(getM2N(), getReceiveData());
+    } else {
+      receiveData(getM2N(), getReceiveData());
     }
-    PRECICE_DEBUG("Receiving data...");
-    receiveData(getM2N(), getReceiveData());
     checkDataHasBeenReceived();
   } else { // second participant
     if (isImplicitCouplingScheme()) {
       PRECICE_DEBUG("Test Convergence and accelerate...");
       convergence = doImplicitStep();
-      sendConvergence(getM2N(), convergence);
+      PRECICE_DEBUG("Sending data...");
+      sendDataAndConvergence(getM2N(), getSendData(), convergence);
+    } else {
+      PRECICE_DEBUG("Sending data...");
+      sendData(getM2N(), getSendData());
     }
-    PRECICE_DEBUG("Sending data...");
-    sendData(getM2N(), getSendData());
     // the second participant does not want new data in the last iteration of the last time window
     if (isCouplingOngoing() || (isImplicitCouplingScheme() && not convergence)) {
-      receiveAndSetTimeWindowSize();
       PRECICE_DEBUG("Receiving data...");
-      receiveData(getM2N(), getReceiveData());
+      receiveDataAndSetTimeWindowSize();
       checkDataHasBeenReceived();
     }
   }
@@ -70,11 +70,11 @@ private:
   /// Determines, if the time window size is received by the participant.
   bool _participantReceivesTimeWindowSize = false;
 
-  /// Sends time window size, if this participant is the one to send
-  void sendTimeWindowSize();
+  /// Sends data and attaches the time window size, if this participant is the one to send it
+  void sendDataAndTimeWindowSize();
 
-  /// Receives and sets the time window size, if this participant is the one to receive
-  void receiveAndSetTimeWindowSize();
+  /// Receives data and sets the time window size attached, if this participant is the one to receive it
+  void receiveDataAndSetTimeWindowSize();
 
   /**
    * @brief Exchanges data between the participants of the SerialCouplingSchemes and applies acceleration.
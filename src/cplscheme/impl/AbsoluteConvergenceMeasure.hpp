@@ -6,7 +6,7 @@
 #include <string>
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
-#include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -41,11 +41,17 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual void addPartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      utils::ReductionBatch &sums)
   {
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
+    _diffIndex = sums.add((newValues - oldValues).squaredNorm());
+  }
+
+  virtual void evaluate(const utils::ReductionBatch &sums)
+  {
+    _normDiff      = sums.sqrt(_diffIndex);
     _isConvergence = _normDiff <= _convergenceLimit;
   }
 
@@ -87,6 +93,9 @@ private:
 
   double _normDiff = 0;
 
+  /// Index of the squared norm of the difference in the batch of partial sums
+  utils::ReductionBatch::Index _diffIndex = 0;
+
   bool _isConvergence = false;
 };
 } // namespace impl
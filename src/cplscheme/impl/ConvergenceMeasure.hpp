@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include "utils/ReductionBatch.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -18,6 +19,10 @@ namespace impl {
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * To combine the global reductions of several measures, the measurement can be split:
+ * addPartialSums() of all measures add their local contributions to a single ReductionBatch,
+ * which is reduced once, before evaluate() completes the measurements.
  */
 class ConvergenceMeasure {
 public:
@@ -33,9 +38,30 @@ public:
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues) = 0;
+      const Eigen::VectorXd &newValues)
+  {
+    utils::ReductionBatch sums;
+    addPartialSums(oldValues, newValues, sums);
+    sums.allreduceSum();
+    evaluate(sums);
+  }
+
+  /**
+   * @brief Starts a convergence measurement by adding the local partial sums it requires.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   * @param[in,out] sums Batch of partial sums, which is reduced before evaluate() is called.
+   */
+  virtual void addPartialSums(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      utils::ReductionBatch &sums) = 0;
+
+  /// Completes the convergence measurement using the reduced partial sums.
+  virtual void evaluate(const utils::ReductionBatch &sums) = 0;
 
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
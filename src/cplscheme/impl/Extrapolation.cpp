@@ -1,6 +1,9 @@
 #include "Extrapolation.hpp"
 #include <algorithm>
+#include <utility>
 #include "cplscheme/CouplingScheme.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 
@@ -47,6 +50,26 @@ const Eigen::VectorXd Extrapolation::getInitialGuess()
   return _timeWindowsStorage.col(0);
 }
 
+void Extrapolation::exportState(io::CheckpointWriter &writer) const
+{
+  writer.writeTag("Extrapolation");
+  writer.write(_numberOfStoredSamples);
+  writer.write(_timeWindowsStorage);
+}
+
+void Extrapolation::importState(io::CheckpointReader &reader)
+{
+  reader.readTag("Extrapolation");
+  Eigen::MatrixXd storage;
+  reader.read(_numberOfStoredSamples);
+  reader.read(storage);
+  PRECICE_CHECK(storage.rows() == _timeWindowsStorage.rows() && storage.cols() == _timeWindowsStorage.cols(),
+                "The extrapolation in the checkpoint stores {} samples of {} values, but {} samples of {} values are required. "
+                "Please restart with the configuration and the number of ranks of the run, which wrote the checkpoint.",
+                storage.cols(), storage.rows(), _timeWindowsStorage.cols(), _timeWindowsStorage.rows());
+  _timeWindowsStorage = std::move(storage);
+}
+
 int Extrapolation::sizeOfSampleStorage()
 {
   PRECICE_ASSERT(_storageIsInitialized);
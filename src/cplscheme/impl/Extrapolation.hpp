@@ -5,6 +5,11 @@
 
 namespace precice {
 
+namespace io {
+class CheckpointReader;
+class CheckpointWriter;
+} // namespace io
+
 namespace testing {
 // Forward declaration to friend the boost test struct
 class ExtrapolationFixture;
@@ -47,6 +52,12 @@ public:
    */
   const Eigen::VectorXd getInitialGuess();
 
+  /// Writes the stored samples to a checkpoint
+  void exportState(io::CheckpointWriter &writer) const;
+
+  /// Reads the samples written by exportState(), the storage needs to be initialized with the same size
+  void importState(io::CheckpointReader &reader);
+
 private:
   /// Set by initialize. Used for consistency checks.
   bool _storageIsInitialized = false;
@@ -20,9 +20,15 @@ public:
 
   virtual void newMeasurementSeries();
 
-  virtual void measure(
+  /// Requires no partial sums
+  virtual void addPartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      utils::ReductionBatch &sums)
+  {
+  }
+
+  virtual void evaluate(const utils::ReductionBatch &sums)
   {
     PRECICE_TRACE();
     _currentIteration++;
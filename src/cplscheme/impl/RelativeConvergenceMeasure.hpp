@@ -11,7 +11,7 @@
 #include "logging/Logger.hpp"
 #include "math/differences.hpp"
 #include "math/math.hpp"
-#include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -56,19 +56,19 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual void addPartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      utils::ReductionBatch &sums)
   {
-    /*
-     std::cout<<"\n-------\n";
-     std::cout<<"   old val: \n"<<oldValues<<'\n';
-     std::cout<<"   new val: \n"<<newValues<<"\n\n";
-     std::cout<<"-------\n\n";
-*/
-
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
-    _norm          = utils::IntraComm::l2norm(newValues);
+    _diffIndex = sums.add((newValues - oldValues).squaredNorm());
+    _normIndex = sums.add(newValues.squaredNorm());
+  }
+
+  virtual void evaluate(const utils::ReductionBatch &sums)
+  {
+    _normDiff      = sums.sqrt(_diffIndex);
+    _norm          = sums.sqrt(_normIndex);
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
   }
 
@@ -118,6 +118,10 @@ private:
 
   double _norm = 0;
 
+  /// Indices of the squared norms of the difference and the new values in the batch of partial sums
+  utils::ReductionBatch::Index _diffIndex = 0;
+  utils::ReductionBatch::Index _normIndex = 0;
+
   bool _isConvergence = false;
 };
 } // namespace impl
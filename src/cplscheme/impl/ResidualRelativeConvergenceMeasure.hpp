@@ -9,7 +9,7 @@
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
 #include "math/differences.hpp"
-#include "utils/IntraComm.hpp"
+#include "utils/ReductionBatch.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -46,11 +46,17 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
+  virtual void addPartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      utils::ReductionBatch &sums)
   {
-    _normDiff = utils::IntraComm::l2norm(newValues - oldValues);
+    _diffIndex = sums.add((newValues - oldValues).squaredNorm());
+  }
+
+  virtual void evaluate(const utils::ReductionBatch &sums)
+  {
+    _normDiff = sums.sqrt(_diffIndex);
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
@@ -104,6 +110,9 @@ private:
 
   double _normDiff = 0;
 
+  /// Index of the squared norm of the difference in the batch of partial sums
+  utils::ReductionBatch::Index _diffIndex = 0;
+
   bool _isConvergence = false;
 };
 } // namespace impl
@@ -231,6 +231,16 @@ public:
     return std::string();
   }
 
+  /**
+   * @brief Empty.
+   */
+  void exportState(io::CheckpointWriter &writer) override final {}
+
+  /**
+   * @brief Empty.
+   */
+  void importState(io::CheckpointReader &reader) override final {}
+
 private:
   mutable logging::Logger _log{"cplscheme::tests::DummyCouplingScheme"};
 
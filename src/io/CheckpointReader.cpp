@@ -0,0 +1,87 @@
+#include "io/CheckpointReader.hpp"
+#include <cstdint>
+#include "logging/LogMacros.hpp"
+
+namespace precice::io {
+
+CheckpointReader::CheckpointReader(
+    const std::string &filename)
+    : _filename(filename)
+{
+  _file.open(filename, std::ios::binary);
+  PRECICE_CHECK(_file, "Checkpoint reader failed to open file \"{}\". "
+                       "Please check that the checkpoint directory is correct and that the previous run wrote a checkpoint.",
+                filename);
+  PRECICE_CHECK(readString() == Magic, "The file \"{}\" is not a preCICE checkpoint.", filename);
+  int version = 0;
+  read(version);
+  PRECICE_CHECK(version == Version, "The checkpoint \"{}\" has version {}, but this version of preCICE reads version {}.", filename, version, Version);
+}
+
+void CheckpointReader::readTag(const std::string &tag)
+{
+  const auto stored = readString();
+  PRECICE_CHECK(stored == tag,
+                "The checkpoint \"{}\" does not match the configuration. Expected the state of \"{}\", but found \"{}\". "
+                "Please restart with the configuration, which wrote the checkpoint.",
+                _filename, tag, stored);
+}
+
+void CheckpointReader::read(int &value)
+{
+  std::int64_t stored;
+  readBytes(&stored, sizeof(stored));
+  value = static_cast<int>(stored);
+}
+
+void CheckpointReader::read(double &value)
+{
+  readBytes(&value, sizeof(value));
+}
+
+void CheckpointReader::read(std::vector<double> &vector)
+{
+  vector.resize(readSize());
+  readBytes(vector.data(), vector.size() * sizeof(double));
+}
+
+void CheckpointReader::read(Eigen::VectorXd &vector)
+{
+  vector.resize(readSize());
+  readBytes(vector.data(), vector.size() * sizeof(double));
+}
+
+void CheckpointReader::read(Eigen::MatrixXd &matrix)
+{
+  const int rows = readSize();
+  const int cols = readSize();
+  matrix.resize(rows, cols);
+  readBytes(matrix.data(), matrix.size() * sizeof(double));
+}
+
+int CheckpointReader::readSize()
+{
+  int size;
+  read(size);
+  PRECICE_CHECK(size >= 0, "The checkpoint \"{}\" is corrupt.", _filename);
+  return size;
+}
+
+std::string CheckpointReader::readString()
+{
+  const int size = readSize();
+  PRECICE_CHECK(size <= MaxTagSize, "The checkpoint \"{}\" is corrupt.", _filename);
+  std::string string(size, '\0');
+  readBytes(string.data(), size);
+  return string;
+}
+
+void CheckpointReader::readBytes(void *data, std::size_t size)
+{
+  _file.read(static_cast<char *>(data), size);
+  PRECICE_CHECK(_file, "The checkpoint \"{}\" ended unexpectedly. "
+                       "The checkpoint is incomplete or was written with a different configuration.",
+                _filename);
+}
+
+} // namespace precice::io
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Reads a checkpoint file written by CheckpointWriter.
+ *
+ * The values have to be read in the order in which they were written.
+ * Reading beyond the end of the file or a tag, which does not match, is an error.
+ */
+class CheckpointReader {
+public:
+  /// Identifies checkpoint files of preCICE
+  static constexpr const char *Magic = "preCICE checkpoint";
+
+  /// Version of the file format, increase on incompatible changes
+  static constexpr int Version = 1;
+
+  /// Opens the checkpoint and verifies its format
+  explicit CheckpointReader(const std::string &filename);
+
+  /// Reads a tag and checks that it matches the given one
+  void readTag(const std::string &tag);
+
+  void read(int &value);
+
+  void read(double &value);
+
+  /// Reads a vector, which is resized to the stored size
+  void read(std::vector<double> &vector);
+
+  /// Reads a vector, which is resized to the stored size
+  void read(Eigen::VectorXd &vector);
+
+  /// Reads a matrix, which is resized to the stored size
+  void read(Eigen::MatrixXd &matrix);
+
+private:
+  logging::Logger _log{"io::CheckpointReader"};
+
+  /// Tags are short, longer strings indicate a corrupt file
+  static constexpr int MaxTagSize = 256;
+
+  std::string _filename;
+
+  std::ifstream _file;
+
+  /// Reads the size of a vector, matrix, or string
+  int readSize();
+
+  std::string readString();
+
+  void readBytes(void *data, std::size_t size);
+};
+
+} // namespace io
+} // namespace precice
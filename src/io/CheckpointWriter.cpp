@@ -0,0 +1,75 @@
+#include "io/CheckpointWriter.hpp"
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include "io/CheckpointReader.hpp"
+#include "logging/LogMacros.hpp"
+
+namespace precice::io {
+
+CheckpointWriter::CheckpointWriter(
+    const std::string &filename)
+    : _filename(filename),
+      _temporaryFilename(filename + ".tmp")
+{
+  namespace fs        = boost::filesystem;
+  const auto location = fs::path(filename).parent_path();
+  if (not location.empty()) {
+    fs::create_directories(location);
+  }
+  _file.open(_temporaryFilename, std::ios::binary | std::ios::trunc);
+  PRECICE_CHECK(_file, "Checkpoint writer failed to open file \"{}\"", _temporaryFilename);
+  writeTag(CheckpointReader::Magic);
+  write(CheckpointReader::Version);
+}
+
+void CheckpointWriter::writeTag(const std::string &tag)
+{
+  write(static_cast<int>(tag.size()));
+  writeBytes(tag.data(), tag.size());
+}
+
+void CheckpointWriter::write(int value)
+{
+  const std::int64_t stored = value;
+  writeBytes(&stored, sizeof(stored));
+}
+
+void CheckpointWriter::write(double value)
+{
+  writeBytes(&value, sizeof(value));
+}
+
+void CheckpointWriter::write(const std::vector<double> &vector)
+{
+  write(static_cast<int>(vector.size()));
+  writeBytes(vector.data(), vector.size() * sizeof(double));
+}
+
+void CheckpointWriter::write(const Eigen::VectorXd &vector)
+{
+  write(static_cast<int>(vector.size()));
+  writeBytes(vector.data(), vector.size() * sizeof(double));
+}
+
+void CheckpointWriter::write(const Eigen::MatrixXd &matrix)
+{
+  write(static_cast<int>(matrix.rows()));
+  write(static_cast<int>(matrix.cols()));
+  writeBytes(matrix.data(), matrix.size() * sizeof(double));
+}
+
+void CheckpointWriter::close()
+{
+  _file.close();
+  PRECICE_CHECK(_file, "Writing the checkpoint file \"{}\" failed. Is the disk full?", _temporaryFilename);
+  boost::system::error_code error;
+  boost::filesystem::rename(_temporaryFilename, _filename, error);
+  PRECICE_CHECK(not error, "Replacing the checkpoint file \"{}\" failed with: {}", _filename, error.message());
+}
+
+void CheckpointWriter::writeBytes(const void *data, std::size_t size)
+{
+  _file.write(static_cast<const char *>(data), size);
+}
+
+} // namespace precice::io
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Writes the coupling state of a rank to a binary checkpoint file, which is read by CheckpointReader.
+ *
+ * Values are stored in the native binary representation, hence checkpoints can only be read on the same architecture.
+ * The writer fills a temporary file, which replaces the checkpoint on close(). Hence, an interrupted write does not
+ * destroy the last complete checkpoint.
+ */
+class CheckpointWriter {
+public:
+  /// Opens the temporary file for the checkpoint of the given name
+  explicit CheckpointWriter(const std::string &filename);
+
+  /// Writes a tag, which the reader uses to verify that the state is read by the matching object
+  void writeTag(const std::string &tag);
+
+  void write(int value);
+
+  void write(double value);
+
+  void write(const std::vector<double> &vector);
+
+  void write(const Eigen::VectorXd &vector);
+
+  void write(const Eigen::MatrixXd &matrix);
+
+  /// Completes the checkpoint and replaces a previous checkpoint of the same name
+  void close();
+
+private:
+  logging::Logger _log{"io::CheckpointWriter"};
+
+  std::string _filename;
+
+  std::string _temporaryFilename;
+
+  std::ofstream _file;
+
+  void writeBytes(const void *data, std::size_t size);
+};
+
+} // namespace io
+} // namespace precice
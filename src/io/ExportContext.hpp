@@ -22,6 +22,9 @@ struct ExportContext {
 
   // @brief type of the exporter (e.g. vtk).
   std::string type;
+
+  // @brief Number of consecutive ranks writing their pieces to a common file.
+  int ranksPerFile = 1;
 };
 
 } // namespace io
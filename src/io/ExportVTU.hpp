@@ -25,6 +25,9 @@ namespace io {
  * The naming scheme allows to import these files into Paraview as time series.
  */
 class ExportVTU : public ExportXML {
+public:
+  using ExportXML::ExportXML;
+
 private:
   mutable logging::Logger _log{"io::ExportVTU"};
 
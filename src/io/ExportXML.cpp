@@ -4,7 +4,9 @@
 #include <boost/filesystem.hpp>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include "com/Communication.hpp"
 #include "io/Export.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
@@ -20,6 +22,12 @@
 
 namespace precice::io {
 
+ExportXML::ExportXML(int ranksPerFile)
+    : _ranksPerFile(ranksPerFile)
+{
+  PRECICE_ASSERT(_ranksPerFile > 0, _ranksPerFile);
+}
+
 void ExportXML::doExport(
     const std::string &name,
     const std::string &location,
@@ -32,11 +40,25 @@ void ExportXML::doExport(
   if (utils::IntraComm::isPrimary()) {
     writeParallelFile(name, location, mesh);
   }
-  if (mesh.vertices().size() > 0) { // only procs at the coupling interface should write output (for performance reasons)
+  if ((_ranksPerFile > 1) && utils::IntraComm::isParallel()) {
+    writeAggregatedSubFile(name, location, mesh);
+  } else if (mesh.vertices().size() > 0) { // only procs at the coupling interface should write output (for performance reasons)
     writeSubFile(name, location, mesh);
   }
 }
 
+Rank ExportXML::getFileRank(Rank rank) const
+{
+  if (_ranksPerFile == 1) {
+    return rank;
+  }
+  // Secondary ranks can only send their pieces to the primary rank
+  if (not utils::IntraComm::getCommunication()->connectsAllRanks()) {
+    return 0;
+  }
+  return rank - rank % _ranksPerFile;
+}
+
 void ExportXML::processDataNamesAndDimensions(const mesh::Mesh &mesh)
 {
   _vectorDataNames.clear();
@@ -91,17 +113,22 @@ void ExportXML::writeParallelFile(
 
   writeParallelData(outParallelFile);
 
+  // Reference the files of all groups of ranks with vertices
   const auto &offsets = mesh.getVertexOffsets();
-  PRECICE_ASSERT(offsets.size() > 0);
-  if (offsets[0] > 0) {
-    outParallelFile << "      <Piece Source=\"" << name << "_" << 0 << getPieceExtension() << "\"/>\n";
-  }
-  for (size_t rank : utils::IntraComm::allSecondaryRanks()) {
-    PRECICE_ASSERT(rank < offsets.size());
-    if (offsets[rank] - offsets[rank - 1] > 0) {
+  const Rank  size    = utils::IntraComm::getSize();
+  PRECICE_ASSERT(offsets.size() >= static_cast<std::size_t>(size), offsets.size(), size);
+  for (Rank first = 0; first < size;) {
+    const Rank fileRank = getFileRank(first);
+    Rank       last     = first;
+    while ((last + 1 < size) && (getFileRank(last + 1) == fileRank)) {
+      ++last;
+    }
+    const int verticesBefore = (first == 0) ? 0 : offsets[first - 1];
+    if (offsets[last] - verticesBefore > 0) {
       // only non-empty subfiles
-      outParallelFile << "      <Piece Source=\"" << name << "_" << rank << getPieceExtension() << "\"/>\n";
+      outParallelFile << "      <Piece Source=\"" << name << "_" << fileRank << getPieceExtension() << "\"/>\n";
     }
+    first = last + 1;
   }
 
   outParallelFile << "   </P" << formatType << ">\n";
@@ -132,28 +159,87 @@ void ExportXML::writeSubFile(
 
   PRECICE_CHECK(outSubFile, "{} export failed to open secondary file \"{}\"", getVTKFormat(), outfile.generic_string());
 
-  const auto formatType = getVTKFormat();
-  outSubFile << "<?xml version=\"1.0\"?>\n";
-  outSubFile << "<VTKFile type=\"" << formatType << "\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">") << '\n';
+  writeSubFileHeader(outSubFile);
+  writePiece(outSubFile, mesh);
+  writeSubFileFooter(outSubFile);
 
-  outSubFile << "   <" << formatType << ">\n";
-  outSubFile << "      <Piece " << getPieceAttributes(mesh) << "> \n";
-  exportPoints(outSubFile, mesh);
+  outSubFile.close();
+}
 
-  // Write Mesh
-  exportConnectivity(outSubFile, mesh);
+void ExportXML::writeAggregatedSubFile(
+    const std::string &name,
+    const std::string &location,
+    const mesh::Mesh & mesh) const
+{
+  const Rank rank     = utils::IntraComm::getRank();
+  const Rank fileRank = getFileRank(rank);
+  auto &     com      = utils::IntraComm::getCommunication();
+
+  // The pieces are serialized concurrently on all ranks of the group
+  std::ostringstream ownPiece;
+  if (mesh.vertices().size() > 0) {
+    writePiece(ownPiece, mesh);
+  }
+  if (rank != fileRank) {
+    com->send(ownPiece.str(), com->connectsAllRanks() ? fileRank : 0);
+    return;
+  }
 
-  // Write data
-  exportData(outSubFile, mesh);
+  std::vector<std::string> pieces{ownPiece.str()};
+  for (Rank other = rank + 1; (other < utils::IntraComm::getSize()) && (getFileRank(other) == fileRank); ++other) {
+    pieces.emplace_back();
+    com->receive(pieces.back(), other);
+  }
+  if (std::all_of(pieces.begin(), pieces.end(), [](const std::string &piece) { return piece.empty(); })) {
+    return; // The parallel file does not reference files without vertices
+  }
 
-  outSubFile << "      </Piece>\n";
-  outSubFile << "   </" << formatType << "> \n";
-  outSubFile << "</VTKFile>\n";
+  namespace fs = boost::filesystem;
+  fs::path outfile(location);
+  outfile /= fs::path(name + "_" + std::to_string(fileRank) + getPieceExtension());
+  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
+
+  PRECICE_CHECK(outSubFile, "{} export failed to open secondary file \"{}\"", getVTKFormat(), outfile.generic_string());
+
+  writeSubFileHeader(outSubFile);
+  for (const auto &piece : pieces) {
+    outSubFile << piece;
+  }
+  writeSubFileFooter(outSubFile);
 
   outSubFile.close();
 }
 
+void ExportXML::writeSubFileHeader(std::ostream &outFile) const
+{
+  outFile << "<?xml version=\"1.0\"?>\n";
+  outFile << "<VTKFile type=\"" << getVTKFormat() << "\" version=\"0.1\" byte_order=\"";
+  outFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">") << '\n';
+  outFile << "   <" << getVTKFormat() << ">\n";
+}
+
+void ExportXML::writeSubFileFooter(std::ostream &outFile) const
+{
+  outFile << "   </" << getVTKFormat() << "> \n";
+  outFile << "</VTKFile>\n";
+}
+
+void ExportXML::writePiece(
+    std::ostream &    outFile,
+    const mesh::Mesh &mesh) const
+{
+  outFile << "      <Piece " << getPieceAttributes(mesh) << "> \n";
+  exportPoints(outFile, mesh);
+
+  // Write Mesh
+  exportConnectivity(outFile, mesh);
+
+  // Write data
+  exportData(outFile, mesh);
+
+  outFile << "      </Piece>\n";
+}
+
 void ExportXML::exportGradient(const mesh::PtrData data, const int spaceDim, std::ostream &outFile) const
 {
   const auto &             gradientValues = data->gradientValues();
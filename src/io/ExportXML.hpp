@@ -7,6 +7,7 @@
 #include "io/Export.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "precice/types.hpp"
 
 namespace precice {
 namespace mesh {
@@ -20,9 +21,24 @@ class Tetrahedron;
 namespace precice {
 namespace io {
 
-/// Common class to generate the VTK XML-based formats.
+/**
+ * @brief Common class to generate the VTK XML-based formats.
+ *
+ * In parallel, every rank writes its part of the mesh as a piece and the primary rank writes a parallel file
+ * referencing all pieces. To reduce the number of files, consecutive ranks can be grouped: the first rank of
+ * a group collects the pieces of the group via the intra-participant communication and writes them to a
+ * single file. If the intra-participant communication does not connect all ranks, the primary rank collects
+ * all pieces.
+ */
 class ExportXML : public Export {
 public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] ranksPerFile Number of consecutive ranks writing their pieces to a common file.
+   */
+  explicit ExportXML(int ranksPerFile = 1);
+
   void doExport(
       const std::string &name,
       const std::string &location,
@@ -47,6 +63,9 @@ public:
 private:
   mutable logging::Logger _log{"io::ExportXML"};
 
+  /// Number of consecutive ranks writing their pieces to a common file
+  int _ranksPerFile;
+
   /// List of names of all scalar data on mesh
   std::vector<std::string> _scalarDataNames;
 
@@ -76,6 +95,9 @@ private:
 
   void writeParallelData(std::ostream &out) const;
 
+  /// Returns the rank writing the file containing the piece of the given rank
+  Rank getFileRank(Rank rank) const;
+
   /**
    * @brief Writes the sub file for each rank
    */
@@ -84,6 +106,24 @@ private:
       const std::string &location,
       const mesh::Mesh & mesh) const;
 
+  /**
+   * @brief Writes the pieces of a group of ranks to the sub file of the first rank of the group
+   *
+   * The other ranks of the group send their pieces to the first rank.
+   */
+  void writeAggregatedSubFile(
+      const std::string &name,
+      const std::string &location,
+      const mesh::Mesh & mesh) const;
+
+  void writeSubFileHeader(std::ostream &outFile) const;
+
+  void writeSubFileFooter(std::ostream &outFile) const;
+
+  void writePiece(
+      std::ostream &    outFile,
+      const mesh::Mesh &mesh) const;
+
   void exportPoints(
       std::ostream &    outFile,
       const mesh::Mesh &mesh) const;
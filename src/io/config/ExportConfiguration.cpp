@@ -44,7 +44,16 @@ ExportConfiguration::ExportConfiguration(xml::XMLTag &parent)
   auto attrEveryIteration = makeXMLAttribute(ATTR_EVERY_ITERATION, false)
                                 .setDocumentation("Exports in every coupling (sub)iteration. For debug purposes.");
 
+  auto attrRanksPerFile = makeXMLAttribute(ATTR_RANKS_PER_FILE, 1)
+                              .setDocumentation("Number of consecutive ranks of a parallel participant, which write their pieces to a common file. "
+                                                "The first rank of each group collects the pieces of the group and writes the file. "
+                                                "Larger groups result in fewer but larger files, which reduces the load on parallel file systems. "
+                                                "Has no effect on CSV exports.");
+
   for (XMLTag &tag : tags) {
+    if (tag.getName() != VALUE_CSV) {
+      tag.addAttribute(attrRanksPerFile);
+    }
     tag.addAttribute(attrLocation);
     tag.addAttribute(attrEveryNTimeWindows);
     tag.addAttribute(attrNormals);
@@ -67,6 +76,12 @@ void ExportConfiguration::xmlTagCallback(
     econtext.everyNTimeWindows = tag.getIntAttributeValue(ATTR_EVERY_N_TIME_WINDOWS);
     econtext.everyIteration    = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
     econtext.type              = tag.getName();
+    if (econtext.type != VALUE_CSV) {
+      econtext.ranksPerFile = tag.getIntAttributeValue(ATTR_RANKS_PER_FILE);
+      PRECICE_CHECK(econtext.ranksPerFile > 0,
+                    "The attribute \"{}\" of the <export:{}/> tag has to be a positive number, but is {}.",
+                    ATTR_RANKS_PER_FILE, econtext.type, econtext.ranksPerFile);
+    }
     _contexts.push_back(econtext);
   }
 }
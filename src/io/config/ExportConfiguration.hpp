@@ -51,6 +51,7 @@ private:
   const std::string ATTR_NEIGHBORS            = "neighbors";
   const std::string ATTR_NORMALS              = "normals";
   const std::string ATTR_EVERY_ITERATION      = "every-iteration";
+  const std::string ATTR_RANKS_PER_FILE       = "ranks-per-file";
 
   std::list<ExportContext> _contexts;
 };
@@ -0,0 +1,79 @@
+#include <Eigen/Core>
+#include <vector>
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+BOOST_AUTO_TEST_SUITE(CheckpointTests)
+
+using namespace precice;
+using namespace precice::io;
+
+BOOST_AUTO_TEST_CASE(WriteAndRead)
+{
+  PRECICE_TEST(1_rank);
+  const std::string filename = "io-CheckpointTest/state.checkpoint";
+
+  std::vector<double> vector{1.0, -2.5, 3.25};
+  Eigen::VectorXd     eigenVector(4);
+  eigenVector << 0.1, 0.2, 0.3, 0.4;
+  Eigen::MatrixXd matrix(2, 3);
+  matrix << 1, 2, 3, 4, 5, 6;
+
+  {
+    CheckpointWriter writer(filename);
+    writer.writeTag("Test");
+    writer.write(42);
+    writer.write(3.5);
+    writer.write(vector);
+    writer.write(eigenVector);
+    writer.write(matrix);
+    writer.write(Eigen::MatrixXd());
+    writer.close();
+  }
+
+  // Overwrites the first checkpoint
+  {
+    CheckpointWriter writer(filename);
+    writer.writeTag("Test");
+    writer.write(43);
+    writer.write(4.5);
+    writer.write(vector);
+    writer.write(eigenVector);
+    writer.write(matrix);
+    writer.write(Eigen::MatrixXd());
+    writer.close();
+  }
+
+  CheckpointReader reader(filename);
+  reader.readTag("Test");
+  int    intValue;
+  double doubleValue;
+  reader.read(intValue);
+  reader.read(doubleValue);
+  BOOST_TEST(intValue == 43);
+  BOOST_TEST(doubleValue == 4.5);
+
+  std::vector<double> readVector;
+  reader.read(readVector);
+  BOOST_TEST(readVector == vector, boost::test_tools::per_element());
+
+  Eigen::VectorXd readEigenVector;
+  reader.read(readEigenVector);
+  BOOST_TEST(testing::equals(readEigenVector, eigenVector));
+
+  Eigen::MatrixXd readMatrix;
+  reader.read(readMatrix);
+  BOOST_TEST(readMatrix.rows() == 2);
+  BOOST_TEST(readMatrix.cols() == 3);
+  BOOST_TEST(testing::equals(readMatrix, matrix));
+
+  Eigen::MatrixXd empty(1, 1);
+  reader.read(empty);
+  BOOST_TEST(empty.size() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CheckpointTests
+BOOST_AUTO_TEST_SUITE_END() // IOTests
@@ -2,7 +2,9 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <fstream>
 #include <map>
+#include <sstream>
 #include <string>
 #include "com/SharedPointer.hpp"
 #include "io/Export.hpp"
@@ -144,6 +146,53 @@ BOOST_AUTO_TEST_CASE(ExportPolygonalMesh)
   exportVTU.doExport(filename, location, mesh);
 }
 
+BOOST_AUTO_TEST_CASE(ExportPolygonalMeshAggregated)
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  int        dim = 2;
+  mesh::Mesh mesh("MyMesh", dim, testing::nextMeshID());
+
+  if (context.isRank(0)) {
+    mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector2d::Zero());
+    mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector2d::Constant(1));
+    mesh.createEdge(v1, v2);
+    mesh.setVertexOffsets({2, 2, 4, 5});
+  } else if (context.isRank(1)) {
+    // nothing
+  } else if (context.isRank(2)) {
+    mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector2d::Constant(1));
+    mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector2d::Constant(2));
+    mesh.createEdge(v1, v2);
+  } else if (context.isRank(3)) {
+    mesh.createVertex(Eigen::Vector2d::Constant(3.0));
+  }
+
+  // Ranks 0 and 1 as well as ranks 2 and 3 write to a common file
+  io::ExportVTU exportVTU(2);
+  std::string   filename = "io-ExportVTUTest-testExportPolygonalMeshAggregated";
+  std::string   location = "";
+  exportVTU.doExport(filename, location, mesh);
+
+  const auto readFile = [](const std::string &name) {
+    std::ifstream     file(name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  };
+  if (context.isRank(0)) {
+    const auto parallelFile = readFile(filename + ".pvtu");
+    BOOST_TEST(parallelFile.find(filename + "_0.vtu") != std::string::npos);
+    BOOST_TEST(parallelFile.find(filename + "_1.vtu") == std::string::npos);
+    BOOST_TEST(parallelFile.find(filename + "_2.vtu") != std::string::npos);
+    BOOST_TEST(parallelFile.find(filename + "_3.vtu") == std::string::npos);
+  } else if (context.isRank(2)) {
+    const auto subFile = readFile(filename + "_2.vtu");
+    const auto first   = subFile.find("<Piece ");
+    BOOST_TEST_REQUIRE(first != std::string::npos);
+    BOOST_TEST(subFile.find("<Piece ", first + 1) != std::string::npos);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ExportTriangulatedMesh)
 {
   PRECICE_TEST(""_on(4_ranks).setupIntraComm());
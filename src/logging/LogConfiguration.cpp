@@ -1,18 +1,24 @@
 #include "LogConfiguration.hpp"
 #include <algorithm>
+#include <atomic>
 #include <boost/core/null_deleter.hpp>
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/block_on_overflow.hpp>
+#include <boost/log/sinks/bounded_fifo_queue.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/console.hpp>
 #include <boost/program_options.hpp>
+#include <cstdlib>
 #include <deque>
 #include <fstream>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -148,8 +154,40 @@ void BackendConfiguration::setOption(std::string key, std::string value)
   if (key == "enabled") {
     enabled = utils::convertStringToBool(value);
   }
+  if (key == "asynchronous") {
+    asynchronous = utils::convertStringToBool(value);
+  }
+}
+
+namespace {
+
+std::atomic<int> _configurationVersion{0};
+
+std::atomic<bool> _filtersAreLocationIndependent{true};
+
+/// Returns true, if the filter only references the attributes %Severity%, %Module%, %Rank%, and %Participant%
+bool isLocationIndependent(const std::string &filter)
+{
+  static const std::set<std::string> allowed{"Severity", "Module", "Rank", "Participant"};
+
+  for (auto begin = filter.find('%'); begin != std::string::npos;) {
+    const auto end = filter.find('%', begin + 1);
+    if (end == std::string::npos) {
+      return false;
+    }
+    if (allowed.count(filter.substr(begin + 1, end - begin - 1)) == 0) {
+      return false;
+    }
+    begin = filter.find('%', end + 1);
+  }
+  return true;
 }
 
+/// Number of records an asynchronous sink buffers, before the logging thread blocks
+constexpr unsigned int asynchronousQueueSize = 1024;
+
+} // namespace
+
 void setupLogging(LoggingConfiguration configs, bool enabled)
 {
   if (_precice_logging_config_lock)
@@ -172,7 +210,8 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
       << bl::expressions::attr<std::string>("Function") << ": "
       << bl::expressions::message;
 
-  // Reset
+  // Reset, asynchronous sinks drop queued records on destruction
+  bl::core::get()->flush();
   bl::core::get()->remove_all_sinks();
   bl::core::get()->reset_filter();
 
@@ -194,11 +233,32 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     }
     PRECICE_ASSERT(backend != nullptr, "The logging backend was not initialized properly. Check your log config.");
     backend->auto_flush(true);
-    using sink_t = boost::log::sinks::synchronous_sink<StreamBackend>;
-    boost::shared_ptr<sink_t> sink(new sink_t(backend));
-    sink->set_formatter(boost::log::parse_formatter(config.format));
-    sink->set_filter(boost::log::parse_filter(config.filter));
-    boost::log::core::get()->add_sink(sink);
+    if (config.asynchronous) {
+      using queue_t = bl::sinks::bounded_fifo_queue<asynchronousQueueSize, bl::sinks::block_on_overflow>;
+      using sink_t  = bl::sinks::asynchronous_sink<StreamBackend, queue_t>;
+      boost::shared_ptr<sink_t> sink(new sink_t(backend));
+      sink->set_formatter(bl::parse_formatter(config.format));
+      sink->set_filter(bl::parse_filter(config.filter));
+      bl::core::get()->add_sink(sink);
+    } else {
+      using sink_t = bl::sinks::synchronous_sink<StreamBackend>;
+      boost::shared_ptr<sink_t> sink(new sink_t(backend));
+      sink->set_formatter(bl::parse_formatter(config.format));
+      sink->set_filter(bl::parse_filter(config.filter));
+      bl::core::get()->add_sink(sink);
+    }
+  }
+
+  _filtersAreLocationIndependent = std::all_of(configs.begin(), configs.end(), [](const auto &config) {
+    return isLocationIndependent(config.filter);
+  });
+  ++_configurationVersion;
+
+  // Records queued in asynchronous sinks are discarded on destruction, hence, flush them at exit
+  static bool flushesAtExit = false;
+  if (not flushesAtExit) {
+    std::atexit([] { boost::log::core::get()->flush(); });
+    flushesAtExit = true;
   }
 }
 
@@ -210,11 +270,13 @@ void setupLogging(std::string const &logConfigFile)
 void setMPIRank(int const rank)
 {
   boost::log::attribute_cast<boost::log::attributes::mutable_constant<int>>(boost::log::core::get()->get_global_attributes()["Rank"]).set(rank);
+  ++_configurationVersion;
 }
 
 void setParticipant(std::string const &participant)
 {
   boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>(boost::log::core::get()->get_global_attributes()["Participant"]).set(participant);
+  ++_configurationVersion;
 }
 
 bool _precice_logging_config_lock{false};
@@ -224,4 +286,14 @@ void lockConf()
   _precice_logging_config_lock = true;
 }
 
+int configurationVersion()
+{
+  return _configurationVersion.load(std::memory_order_acquire);
+}
+
+bool filtersAreLocationIndependent()
+{
+  return _filtersAreLocationIndependent.load(std::memory_order_acquire);
+}
+
 } // namespace precice::logging
@@ -19,6 +19,9 @@ struct BackendConfiguration {
   std::string format  = default_formatter;
   bool        enabled = true;
 
+  /// Writes the records from a dedicated thread using a bounded queue
+  bool asynchronous = false;
+
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
 };
@@ -44,6 +47,15 @@ void setParticipant(std::string const &name);
 /// Locks the configuration, ignoring any future calls to setupLogging()
 void lockConf();
 
+/// Returns the version of the logging configuration, which changes with every change of the filters or the attributes used by them
+int configurationVersion();
+
+/** Returns true, if the filters of all sinks only use the attributes Severity, Module, Rank, and Participant.
+ *
+ * Only then loggers can evaluate the filters before formatting the message.
+ */
+bool filtersAreLocationIndependent();
+
 /** The global lock for the log configuration.
  * This variable is always initialized to false and can only be modified by calling lockConf()
  */
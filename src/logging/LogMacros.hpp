@@ -8,9 +8,21 @@
     __FILE__, __LINE__, __func__ \
   }
 
-#define PRECICE_WARN(...) _log.warning(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+// Messages are only formatted, if they pass the filters of at least one sink.
 
-#define PRECICE_INFO(...) _log.info(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+#define PRECICE_WARN(...)                                                                 \
+  do {                                                                                    \
+    if (_log.isEnabled(precice::logging::LogSeverity::Warning)) {                         \
+      _log.warning(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                     \
+  } while (false)
+
+#define PRECICE_INFO(...)                                                              \
+  do {                                                                                 \
+    if (_log.isEnabled(precice::logging::LogSeverity::Info)) {                         \
+      _log.info(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                  \
+  } while (false)
 
 #define PRECICE_ERROR(...)                                                          \
   do {                                                                              \
@@ -43,7 +55,12 @@
 
 #include "utils/ArgumentFormatter.hpp"
 
-#define PRECICE_DEBUG(...) _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+#define PRECICE_DEBUG(...)                                                              \
+  do {                                                                                  \
+    if (_log.isEnabled(precice::logging::LogSeverity::Debug)) {                         \
+      _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                   \
+  } while (false)
 
 #endif // ! PRECICE_NO_DEBUG_LOG
 
@@ -65,8 +82,10 @@
 #include "logging/Tracer.hpp"
 
 // Do not put do {...} while (false) here, it will destroy the _tracer_ right after creation
-#define PRECICE_TRACE(...)                                       \
-  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION); \
-  _log.trace(PRECICE_LOG_LOCATION, std::string{"Entering "} + __func__ + PRECICE_LOG_ARGUMENTS(__VA_ARGS__))
+#define PRECICE_TRACE(...)                                                                                    \
+  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION);                                              \
+  if (_log.isEnabled(precice::logging::LogSeverity::Trace)) {                                                 \
+    _log.trace(PRECICE_LOG_LOCATION, std::string{"Entering "} + __func__ + PRECICE_LOG_ARGUMENTS(__VA_ARGS__)); \
+  }
 
 #endif // ! PRECICE_NO_TRACE_LOG
@@ -1,13 +1,16 @@
 #include "Logger.hpp"
+#include <atomic>
 #include <boost/log/attributes/constant.hpp>
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/attributes/named_scope.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sources/record_ostream.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
 #include <iosfwd>
 #include <utility>
+#include "logging/LogConfiguration.hpp"
 
 namespace precice {
 namespace logging {
@@ -16,27 +19,101 @@ namespace logging {
  *
  * @note The point of using a pimpl for the logger is to remove boost::log from logger.hpp
  */
-class Logger::LoggerImpl : public boost::log::sources::severity_logger<boost::log::trivial::severity_level> {
+class Logger::LoggerImpl {
 public:
+  using Severity = boost::log::trivial::severity_level;
+
   /** Creates a Boost logger for the said module.
    * @param[in] module the name of the module.
    */
-  explicit LoggerImpl(const std::string &module);
+  explicit LoggerImpl(std::string module);
+
+  const std::string &module() const
+  {
+    return _module;
+  }
+
+  /// Returns the lowest severity, which passes the filters of at least one sink
+  int threshold();
+
+  /// Logs the message with the location passed as attributes of the record
+  void log(Severity severity, const LogLocation &loc, const std::string &message);
+
+private:
+  std::string _module;
+
+  /// Attributes of this source, the attributes of a record are added to a copy
+  boost::log::attribute_set _attributes;
+
+  /// Version of the logging configuration, _threshold has been computed for
+  std::atomic<int> _configurationVersion{-1};
+
+  std::atomic<int> _threshold{0};
+
+  /// Opens a record using the attributes of this source and the given attributes of the record
+  boost::log::record openRecord(Severity severity, const LogLocation *loc);
 };
 
-Logger::LoggerImpl::LoggerImpl(const std::string &module)
+Logger::LoggerImpl::LoggerImpl(std::string module)
+    : _module(std::move(module))
 {
-  add_attribute("Module", boost::log::attributes::constant<std::string>(module));
-
   namespace attrs = boost::log::attributes;
   namespace log   = boost::log;
+  _attributes.insert("Module", attrs::constant<std::string>(_module));
+
   log::add_common_attributes();
   log::core::get()->add_global_attribute("Scope", attrs::named_scope());
   log::core::get()->add_global_attribute("Participant", attrs::mutable_constant<std::string>(""));
   log::core::get()->add_global_attribute("Rank", attrs::mutable_constant<int>(0));
-  log::core::get()->add_global_attribute("Line", attrs::mutable_constant<int>(0));
-  log::core::get()->add_global_attribute("File", attrs::mutable_constant<std::string>(""));
-  log::core::get()->add_global_attribute("Function", attrs::mutable_constant<std::string>(""));
+}
+
+boost::log::record Logger::LoggerImpl::openRecord(Severity severity, const LogLocation *loc)
+{
+  namespace attrs = boost::log::attributes;
+
+  boost::log::attribute_set attributes = _attributes;
+  attributes.insert("Severity", attrs::constant<Severity>(severity));
+  if (loc) {
+    attributes.insert("Line", attrs::constant<int>(loc->line));
+    attributes.insert("File", attrs::constant<std::string>(loc->file));
+    attributes.insert("Function", attrs::constant<std::string>(loc->func));
+  }
+  return boost::log::core::get()->open_record(attributes);
+}
+
+int Logger::LoggerImpl::threshold()
+{
+  const int version = configurationVersion();
+  if (_configurationVersion.load(std::memory_order_acquire) == version) {
+    return _threshold.load(std::memory_order_relaxed);
+  }
+
+  // Probe the filters with the severities in increasing order.
+  // This is only valid, if the filters do not depend on the location or other attributes of single records.
+  int threshold = static_cast<int>(Severity::trace);
+  if (filtersAreLocationIndependent()) {
+    threshold = static_cast<int>(Severity::fatal) + 1;
+    for (int severity = static_cast<int>(Severity::trace); severity <= static_cast<int>(Severity::fatal); ++severity) {
+      if (openRecord(static_cast<Severity>(severity), nullptr)) {
+        threshold = severity;
+        break;
+      }
+    }
+  }
+  _threshold.store(threshold, std::memory_order_relaxed);
+  _configurationVersion.store(version, std::memory_order_release);
+  return threshold;
+}
+
+void Logger::LoggerImpl::log(Severity severity, const LogLocation &loc, const std::string &message)
+{
+  auto record = openRecord(severity, &loc);
+  if (record) {
+    boost::log::record_ostream stream(record);
+    stream << message;
+    stream.flush();
+    boost::log::core::get()->push_record(std::move(record));
+  }
 }
 
 Logger::Logger(std::string module)
@@ -45,9 +122,8 @@ Logger::Logger(std::string module)
 // This is required for the std::unique_ptr.
 Logger::~Logger() = default;
 
-// Extracts the name saved in the attribute "Module"
 Logger::Logger(const Logger &other)
-    : Logger{other._impl->get_attributes().find("Module")->second.get_value().extract_or_throw<std::string>()}
+    : Logger{other._impl->module()}
 {
 }
 
@@ -64,21 +140,12 @@ void Logger::swap(Logger &other) noexcept
   _impl.swap(other._impl);
 }
 
-namespace {
-/// Sets the log location in the boost core
-void setLogLocation(LogLocation loc)
-{
-  boost::log::attribute_cast<boost::log::attributes::mutable_constant<int>>(boost::log::core::get()->get_global_attributes()["Line"]).set(loc.line);
-  boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>(boost::log::core::get()->get_global_attributes()["File"]).set(loc.file);
-  boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>(boost::log::core::get()->get_global_attributes()["Function"]).set(loc.func);
-}
-} // namespace
-
 void Logger::error(LogLocation loc, const std::string &mess) noexcept
 {
   try {
-    setLogLocation(loc);
-    BOOST_LOG_SEV(*_impl, boost::log::trivial::severity_level::error) << mess;
+    _impl->log(boost::log::trivial::severity_level::error, loc, mess);
+    // Errors terminate the program, which must not discard queued messages of asynchronous sinks
+    boost::log::core::get()->flush();
   } catch (...) {
   }
 }
@@ -86,8 +153,7 @@ void Logger::error(LogLocation loc, const std::string &mess) noexcept
 void Logger::warning(LogLocation loc, const std::string &mess) noexcept
 {
   try {
-    setLogLocation(loc);
-    BOOST_LOG_SEV(*_impl, boost::log::trivial::severity_level::warning) << mess;
+    _impl->log(boost::log::trivial::severity_level::warning, loc, mess);
   } catch (...) {
   }
 }
@@ -95,8 +161,7 @@ void Logger::warning(LogLocation loc, const std::string &mess) noexcept
 void Logger::info(LogLocation loc, const std::string &mess) noexcept
 {
   try {
-    setLogLocation(loc);
-    BOOST_LOG_SEV(*_impl, boost::log::trivial::severity_level::info) << mess;
+    _impl->log(boost::log::trivial::severity_level::info, loc, mess);
   } catch (...) {
   }
 }
@@ -104,8 +169,7 @@ void Logger::info(LogLocation loc, const std::string &mess) noexcept
 void Logger::debug(LogLocation loc, const std::string &mess) noexcept
 {
   try {
-    setLogLocation(loc);
-    BOOST_LOG_SEV(*_impl, boost::log::trivial::severity_level::debug) << mess;
+    _impl->log(boost::log::trivial::severity_level::debug, loc, mess);
   } catch (...) {
   }
 }
@@ -113,9 +177,17 @@ void Logger::debug(LogLocation loc, const std::string &mess) noexcept
 void Logger::trace(LogLocation loc, const std::string &mess) noexcept
 {
   try {
-    setLogLocation(loc);
-    BOOST_LOG_SEV(*_impl, boost::log::trivial::severity_level::trace) << mess;
+    _impl->log(boost::log::trivial::severity_level::trace, loc, mess);
+  } catch (...) {
+  }
+}
+
+bool Logger::isEnabled(LogSeverity severity) noexcept
+{
+  try {
+    return static_cast<int>(severity) >= _impl->threshold();
   } catch (...) {
+    return true;
   }
 }
 
@@ -13,6 +13,15 @@ struct LogLocation {
   const char *func;
 };
 
+/// Severity of a log message, in increasing order
+enum class LogSeverity : int {
+  Trace = 0,
+  Debug,
+  Info,
+  Warning,
+  Error
+};
+
 /// This class provides a lightweight logger.
 class Logger {
 public:
@@ -37,6 +46,13 @@ public:
   void trace(LogLocation loc, const std::string &mess) noexcept;
   ///@}
 
+  /** Returns true, if messages of the given severity pass the filters of at least one sink.
+   *
+   * The result is cached per logger and recomputed whenever the configuration of the logging changes.
+   * This allows to skip formatting messages, which are discarded anyway.
+   */
+  bool isEnabled(LogSeverity severity) noexcept;
+
 private:
   /// Forward declaration of the implementation of the logger
   class LoggerImpl;
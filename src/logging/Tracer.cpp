@@ -15,7 +15,9 @@ Tracer::Tracer(
 
 Tracer::~Tracer()
 {
-  _log.trace(_loc, std::string{"Leaving "}.append(_loc.func));
+  if (_log.isEnabled(LogSeverity::Trace)) {
+    _log.trace(_loc, std::string{"Leaving "}.append(_loc.func));
+  }
 }
 
 } // namespace precice::logging
@@ -48,6 +48,11 @@ LogConfiguration::LogConfiguration(
                          .setDocumentation("Enables the sink");
   tagSink.addAttribute(attrEnabled);
 
+  auto attrAsynchronous = makeXMLAttribute("asynchronous", false)
+                              .setDocumentation("Writes records in a background thread. "
+                                                "This hides the cost of I/O from the solver at the expense of a bounded delay of the output.");
+  tagSink.addAttribute(attrAsynchronous);
+
   tagLog.addSubtag(tagSink);
   parent.addSubtag(tagLog);
 }
@@ -65,6 +70,7 @@ void LogConfiguration::xmlTagCallback(
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
     config.setOption("enabled", "true"); // Not needed, but correct.
+    config.setOption("asynchronous", tag.getBooleanAttributeValue("asynchronous") ? "true" : "false");
     _logconfig.push_back(config);
   }
 }
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <vector>
+#include "com/SharedPointer.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/span.hpp"
@@ -111,6 +112,31 @@ public:
   /// All ranks receive an array of doubles (different for each rank).
   virtual void receive(precice::span<double> itemsToReceive, int valueDimension) = 0;
 
+  /**
+   * @brief Sends an array of double values from all ranks together with a header of control values.
+   *
+   * The header is the same on all ranks. It reaches the remote ranks, which return true for receivesHeader().
+   */
+  virtual void send(precice::span<double const> itemsToSend, int valueDimension, precice::span<double const> header) = 0;
+
+  /**
+   * @brief All ranks receive an array of doubles, ranks with receivesHeader() also receive the header of the sender.
+   *
+   * The size of the header needs to match the size of the header sent.
+   */
+  virtual void receive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header) = 0;
+
+  /// Returns true, if this rank receives the header sent along with the data
+  virtual bool receivesHeader() const = 0;
+
+  /**
+   * @brief Posts the receive of an array of doubles like receive() and returns without waiting for the data.
+   *
+   * The items must not be accessed before the returned request completed.
+   * Implementations which cannot receive asynchronously receive blocking and return a completed request.
+   */
+  virtual com::PtrRequest aReceive(precice::span<double> itemsToReceive, int valueDimension) = 0;
+
   /*
    * A mapping from remote local ranks to the IDs that must be communicated
    */
@@ -6,8 +6,10 @@
 
 namespace precice::m2n {
 GatherScatterComFactory::GatherScatterComFactory(
-    com::PtrCommunication intraComm)
-    : _intraComm(std::move(intraComm))
+    com::PtrCommunication intraComm,
+    com::PayloadCodec     codec)
+    : _intraComm(std::move(intraComm)),
+      _codec(codec)
 {
 }
 
@@ -15,6 +17,6 @@ DistributedCommunication::SharedPointer
 GatherScatterComFactory::newDistributedCommunication(mesh::PtrMesh mesh)
 {
   return DistributedCommunication::SharedPointer(
-      new GatherScatterCommunication(_intraComm, mesh));
+      new GatherScatterCommunication(_intraComm, mesh, _codec));
 }
 } // namespace precice::m2n
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DistributedComFactory.hpp"
+#include "com/PayloadCodec.hpp"
 #include "com/SharedPointer.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -9,7 +10,7 @@ namespace precice {
 namespace m2n {
 class GatherScatterComFactory : public DistributedComFactory {
 public:
-  GatherScatterComFactory(com::PtrCommunication intraComm);
+  GatherScatterComFactory(com::PtrCommunication intraComm, com::PayloadCodec codec = com::PayloadCodec::None);
 
   DistributedCommunication::SharedPointer newDistributedCommunication(
       mesh::PtrMesh mesh);
@@ -17,6 +18,9 @@ public:
 private:
   /// communication between the primary processes
   com::PtrCommunication _intraComm;
+
+  /// codec of the data payloads between the primary processes
+  com::PayloadCodec _codec;
 };
 } // namespace m2n
 } // namespace precice
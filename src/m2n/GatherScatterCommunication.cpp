@@ -7,6 +7,8 @@
 
 #include "GatherScatterCommunication.hpp"
 #include "com/Communication.hpp"
+#include "com/PayloadCodec.hpp"
+#include "com/Request.hpp"
 #include "logging/LogMacros.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/Mesh.hpp"
@@ -18,9 +20,11 @@
 namespace precice::m2n {
 GatherScatterCommunication::GatherScatterCommunication(
     com::PtrCommunication com,
-    mesh::PtrMesh         mesh)
+    mesh::PtrMesh         mesh,
+    com::PayloadCodec     codec)
     : DistributedCommunication(std::move(mesh)),
       _com(std::move(com)),
+      _codec(codec),
       _isConnected(false)
 {
 }
@@ -99,7 +103,12 @@ void copy_from_indirect_blocks(
 
 void GatherScatterCommunication::send(precice::span<double const> itemsToSend, int valueDimension)
 {
-  PRECICE_TRACE(itemsToSend.size());
+  send(itemsToSend, valueDimension, {});
+}
+
+void GatherScatterCommunication::send(precice::span<double const> itemsToSend, int valueDimension, precice::span<double const> header)
+{
+  PRECICE_TRACE(itemsToSend.size(), header.size());
 
   // Gather data on secondary ranks
   if (utils::IntraComm::isSecondary()) { // Secondary rank
@@ -144,14 +153,24 @@ void GatherScatterCommunication::send(precice::span<double const> itemsToSend, i
     add_to_indirect_blocks(secondaryRankValues, secondaryDistribution, valueDimension, globalItemsToSend);
   }
 
-  // Send data to other primary
+  // Send data to other primary, preceded by the header
   PRECICE_DEBUG("Sending gathered data to other participant");
-  _com->sendRange(globalItemsToSend, 0);
+  globalItemsToSend.insert(globalItemsToSend.begin(), header.begin(), header.end());
+  if (_codec == com::PayloadCodec::None) {
+    _com->sendRange(globalItemsToSend, 0);
+  } else {
+    _com->sendRange(com::encodePayload(_codec, globalItemsToSend), 0);
+  }
 }
 
 void GatherScatterCommunication::receive(precice::span<double> itemsToReceive, int valueDimension)
 {
-  PRECICE_TRACE(itemsToReceive.size());
+  receive(itemsToReceive, valueDimension, {});
+}
+
+void GatherScatterCommunication::receive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header)
+{
+  PRECICE_TRACE(itemsToReceive.size(), header.size());
 
   // Secondary ranks receive scattered data
   if (utils::IntraComm::isSecondary()) { // Secondary rank
@@ -171,7 +190,14 @@ void GatherScatterCommunication::receive(precice::span<double> itemsToReceive, i
   PRECICE_DEBUG("Receiving {} elements from other participant to scatter", globalSize);
 
   auto globalItemsToReceive = _com->receiveRange(0, com::AsVectorTag<double>{});
-  PRECICE_ASSERT(globalItemsToReceive.size() == static_cast<std::size_t>(globalSize));
+  if (_codec != com::PayloadCodec::None) {
+    std::vector<double> decoded(header.size() + globalSize);
+    com::decodePayload(globalItemsToReceive, decoded);
+    globalItemsToReceive = std::move(decoded);
+  }
+  PRECICE_ASSERT(globalItemsToReceive.size() == header.size() + globalSize, globalItemsToReceive.size(), header.size(), globalSize);
+  std::copy_n(globalItemsToReceive.begin(), header.size(), header.begin());
+  globalItemsToReceive.erase(globalItemsToReceive.begin(), globalItemsToReceive.begin() + header.size());
 
   const auto &vertexDistribution = _mesh->getVertexDistribution();
 
@@ -220,6 +246,18 @@ void GatherScatterCommunication::requestPreConnection(
   PRECICE_ASSERT(false, "Not available for GatherScatterCommunication.");
 }
 
+bool GatherScatterCommunication::receivesHeader() const
+{
+  return not utils::IntraComm::isSecondary();
+}
+
+com::PtrRequest GatherScatterCommunication::aReceive(precice::span<double> itemsToReceive, int valueDimension)
+{
+  // Scattering involves all ranks of the participant, hence the receive blocks
+  receive(itemsToReceive, valueDimension);
+  return std::make_shared<com::CompletedRequest>();
+}
+
 void GatherScatterCommunication::broadcastSend(int itemToSend)
 {
   PRECICE_ASSERT(false, "Not available for GatherScatterCommunication.");
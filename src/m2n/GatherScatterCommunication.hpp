@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include "DistributedCommunication.hpp"
+#include "com/PayloadCodec.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -21,7 +22,8 @@ class GatherScatterCommunication : public DistributedCommunication {
 public:
   GatherScatterCommunication(
       com::PtrCommunication com,
-      mesh::PtrMesh         mesh);
+      mesh::PtrMesh         mesh,
+      com::PayloadCodec     codec = com::PayloadCodec::None);
 
   ~GatherScatterCommunication() override;
 
@@ -87,6 +89,18 @@ public:
   /// All ranks receive an array of doubles (different for each rank).
   void receive(precice::span<double> itemsToReceive, int valueDimension) override;
 
+  /// Sends an array of double values from all ranks, the primary rank adds the header to the gathered data.
+  void send(precice::span<double const> itemsToSend, int valueDimension, precice::span<double const> header) override;
+
+  /// All ranks receive an array of doubles, only the primary rank receives the header.
+  void receive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header) override;
+
+  /// Returns true on the primary rank, which receives the data of the remote participant
+  bool receivesHeader() const override;
+
+  /// Receives like receive(), the returned request is completed already
+  com::PtrRequest aReceive(precice::span<double> itemsToReceive, int valueDimension) override;
+
   /// Broadcasts an int to connected ranks on remote participant. Not available for GatherScatterCommunication.
   void broadcastSend(int itemToSend) override;
 
@@ -114,6 +128,9 @@ private:
   /// primary to primary basic communication
   com::PtrCommunication _com;
 
+  /// Codec of the data payloads sent to the remote primary
+  com::PayloadCodec _codec;
+
   /// Global communication is set up or not
   bool _isConnected;
 };
@@ -4,6 +4,7 @@
 #include "DistributedCommunication.hpp"
 #include "M2N.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Mesh.hpp"
 #include "precice/types.hpp"
@@ -210,12 +211,23 @@ void M2N::send(
     precice::span<double const> itemsToSend,
     int                         meshID,
     int                         valueDimension)
+{
+  send(itemsToSend, meshID, valueDimension, {});
+}
+
+void M2N::send(
+    precice::span<double const> itemsToSend,
+    int                         meshID,
+    int                         valueDimension,
+    precice::span<double const> header)
 {
   if (not _useOnlyPrimaryCom) {
     PRECICE_ASSERT(_areSecondaryRanksConnected);
     PRECICE_ASSERT(_distComs.find(meshID) != _distComs.end());
     PRECICE_ASSERT(_distComs[meshID].get() != nullptr);
 
+    const auto route = header.empty() ? HeaderRoute::Data : sendHeaderRoute(meshID);
+
     if (precice::syncMode && not utils::IntraComm::isSecondary()) {
       bool ack = true;
       _intraComm->send(ack, 0);
@@ -223,11 +235,18 @@ void M2N::send(
       _intraComm->send(ack, 0);
     }
 
+    if (route == HeaderRoute::Separate && not utils::IntraComm::isSecondary()) {
+      _intraComm->send(header, 0);
+    }
+
     Event e("m2n.sendData", precice::syncMode);
 
-    _distComs[meshID]->send(itemsToSend, valueDimension);
+    _distComs[meshID]->send(itemsToSend, valueDimension, header);
   } else {
     PRECICE_ASSERT(_isPrimaryRankConnected);
+    if (not header.empty()) {
+      _intraComm->send(header, 0);
+    }
     _intraComm->send(itemsToSend, 0);
   }
 }
@@ -281,12 +300,22 @@ void M2N::broadcastSend(int itemToSend, mesh::Mesh &mesh)
 void M2N::receive(precice::span<double> itemsToReceive,
                   int                   meshID,
                   int                   valueDimension)
+{
+  receive(itemsToReceive, meshID, valueDimension, {});
+}
+
+void M2N::receive(precice::span<double> itemsToReceive,
+                  int                   meshID,
+                  int                   valueDimension,
+                  precice::span<double> header)
 {
   if (not _useOnlyPrimaryCom) {
     PRECICE_ASSERT(_areSecondaryRanksConnected);
     PRECICE_ASSERT(_distComs.find(meshID) != _distComs.end());
     PRECICE_ASSERT(_distComs[meshID].get() != nullptr);
 
+    const auto route = header.empty() ? HeaderRoute::Data : receiveHeaderRoute(meshID);
+
     if (precice::syncMode) {
       if (not utils::IntraComm::isSecondary()) {
         bool ack;
@@ -297,15 +326,41 @@ void M2N::receive(precice::span<double> itemsToReceive,
       }
     }
 
+    if (route == HeaderRoute::Separate && not utils::IntraComm::isSecondary()) {
+      _intraComm->receive(header, 0);
+    }
+
     Event e("m2n.receiveData", precice::syncMode);
 
-    _distComs[meshID]->receive(itemsToReceive, valueDimension);
+    _distComs[meshID]->receive(itemsToReceive, valueDimension, header);
+
+    if (route != HeaderRoute::Data) {
+      utils::IntraComm::broadcast(header);
+    }
   } else {
     PRECICE_ASSERT(_isPrimaryRankConnected);
+    if (not header.empty()) {
+      _intraComm->receive(header, 0);
+    }
     _intraComm->receive(itemsToReceive, 0);
   }
 }
 
+com::PtrRequest M2N::aReceive(precice::span<double> itemsToReceive,
+                              int                   meshID,
+                              int                   valueDimension)
+{
+  if (_useOnlyPrimaryCom || precice::syncMode) {
+    receive(itemsToReceive, meshID, valueDimension);
+    return std::make_shared<com::CompletedRequest>();
+  }
+
+  PRECICE_ASSERT(_areSecondaryRanksConnected);
+  PRECICE_ASSERT(_distComs.find(meshID) != _distComs.end());
+  PRECICE_ASSERT(_distComs[meshID].get() != nullptr);
+  return _distComs[meshID]->aReceive(itemsToReceive, valueDimension);
+}
+
 void M2N::receive(bool &itemToReceive)
 {
   PRECICE_TRACE(utils::IntraComm::getRank());
@@ -359,5 +414,44 @@ void M2N::gatherAllCommunicationMap(std::map<int, std::vector<int>> &localCommun
   _distComs[meshID]->gatherAllCommunicationMap(localCommunicationMap);
 }
 
+M2N::HeaderRoute M2N::sendHeaderRoute(int meshID)
+{
+  if (auto iter = _sendHeaderRoutes.find(meshID); iter != _sendHeaderRoutes.end()) {
+    return iter->second;
+  }
+
+  // Only the primary rank needs to know whether to send the control values separately
+  int route = static_cast<int>(HeaderRoute::Data);
+  if (not utils::IntraComm::isSecondary()) {
+    _intraComm->receive(route, 0);
+  }
+  PRECICE_DEBUG("Control values along with data of mesh {} take route {}", meshID, route);
+  _sendHeaderRoutes[meshID] = static_cast<HeaderRoute>(route);
+  return _sendHeaderRoutes[meshID];
+}
+
+M2N::HeaderRoute M2N::receiveHeaderRoute(int meshID)
+{
+  if (auto iter = _receiveHeaderRoutes.find(meshID); iter != _receiveHeaderRoutes.end()) {
+    return iter->second;
+  }
+
+  int missing      = _distComs[meshID]->receivesHeader() ? 0 : 1;
+  int totalMissing = 0;
+  utils::IntraComm::allreduceSum(missing, totalMissing);
+
+  // Secondary ranks only need to know whether to take part in the broadcast
+  HeaderRoute route = HeaderRoute::Data;
+  if (totalMissing > 0) {
+    route = (missing == 0) ? HeaderRoute::Broadcast : HeaderRoute::Separate;
+  }
+  if (not utils::IntraComm::isSecondary()) {
+    _intraComm->send(static_cast<int>(route), 0);
+  }
+  PRECICE_DEBUG("Control values along with data of mesh {} take route {}", meshID, static_cast<int>(route));
+  _receiveHeaderRoutes[meshID] = route;
+  return route;
+}
+
 } // namespace m2n
 } // namespace precice
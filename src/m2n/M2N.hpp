@@ -151,6 +151,19 @@ public:
             int                         meshID,
             int                         valueDimension);
 
+  /**
+   * @brief Sends an array of double values from all ranks together with control values, which are the same on all ranks.
+   *
+   * The control values travel in the messages of the data, see DistributedCommunication::receivesHeader().
+   * If this does not reach every rank of the remote participant, the remote primary rank broadcasts them.
+   * If it does not even reach the remote primary rank, the primary rank additionally sends them to it.
+   * The receiving participant determines this route once per mesh.
+   */
+  void send(precice::span<double const> itemsToSend,
+            int                         meshID,
+            int                         valueDimension,
+            precice::span<double const> header);
+
   /**
    * @brief The primary rank sends a bool to the other primary rank, for performance reasons, we
    * neglect the gathering and checking step.
@@ -179,6 +192,23 @@ public:
                int                   meshID,
                int                   valueDimension);
 
+  /// All ranks receive an array of doubles (different for each rank) and the control values sent along, see send()
+  void receive(precice::span<double> itemsToReceive,
+               int                   meshID,
+               int                   valueDimension,
+               precice::span<double> header);
+
+  /**
+   * @brief All ranks post the receive of an array of doubles (different for each rank) and return without waiting for it.
+   *
+   * The items must not be accessed before the returned request completed.
+   * This allows to receive from several participants at once, see DistributedCommunication::aReceive().
+   * In sync mode and if only the primary ranks communicate, the data is received blocking.
+   */
+  com::PtrRequest aReceive(precice::span<double> itemsToReceive,
+                           int                   meshID,
+                           int                   valueDimension);
+
   /// All ranks receive a bool (the same for each rank).
   void receive(bool &itemToReceive);
 
@@ -210,6 +240,19 @@ private:
 
   com::PtrCommunication _intraComm;
 
+  /// Route of the control values sent along with the data, see send()
+  enum class HeaderRoute {
+    Data,      ///< All ranks receive the control values with the data
+    Broadcast, ///< The primary rank receives the control values with the data and broadcasts them
+    Separate   ///< The primary rank receives the control values in an additional message and broadcasts them
+  };
+
+  /// mesh::getID() -> Route of the control values sent along with the data of the mesh
+  std::map<int, HeaderRoute> _sendHeaderRoutes;
+
+  /// mesh::getID() -> Route of the control values received along with the data of the mesh
+  std::map<int, HeaderRoute> _receiveHeaderRoutes;
+
   DistributedComFactory::SharedPointer _distrFactory;
 
   bool _isPrimaryRankConnected = false;
@@ -230,6 +273,12 @@ private:
   /// use the two-level initialization concept
   bool _useTwoLevelInit = false;
 
+  /// Receives the route of the control values from the receiving participant on first use of the mesh
+  HeaderRoute sendHeaderRoute(int meshID);
+
+  /// Determines the route of the control values on first use of the mesh and sends it to the sending participant
+  HeaderRoute receiveHeaderRoute(int meshID);
+
   // @brief To allow access to _useOnlyPrimaryCom
   friend struct WhiteboxAccessor;
 };
@@ -8,13 +8,13 @@
 
 namespace precice::m2n {
 
-PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory)
-    : _comFactory(std::move(comFactory)) {}
+PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory, bool useProgressThread, com::PayloadCodec codec)
+    : _comFactory(std::move(comFactory)), _useProgressThread(useProgressThread), _codec(codec) {}
 
 DistributedCommunication::SharedPointer
 PointToPointComFactory::newDistributedCommunication(mesh::PtrMesh mesh)
 {
-  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh));
+  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh, _useProgressThread, _codec));
 }
 
 } // namespace precice::m2n
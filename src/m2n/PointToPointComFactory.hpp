@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DistributedComFactory.hpp"
+#include "com/PayloadCodec.hpp"
 #include "com/SharedPointer.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -11,7 +12,14 @@ namespace m2n {
 class PointToPointComFactory : public DistributedComFactory {
 
 public:
-  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory);
+  /**
+   * @param[in] comFactory the factory for the communications between the ranks
+   * @param[in] useProgressThread drive the requests of the created communications in a background thread
+   * @param[in] codec the codec of the data payloads
+   */
+  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory,
+                                  bool                         useProgressThread = false,
+                                  com::PayloadCodec            codec             = com::PayloadCodec::None);
 
   DistributedCommunication::SharedPointer newDistributedCommunication(
       mesh::PtrMesh mesh);
@@ -19,6 +27,10 @@ public:
 private:
   /// communication factory for 1:M communications
   com::PtrCommunicationFactory _comFactory;
+
+  bool _useProgressThread;
+
+  com::PayloadCodec _codec;
 };
 
 } // namespace m2n
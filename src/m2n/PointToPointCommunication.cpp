@@ -15,6 +15,8 @@
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
+#include "com/PayloadCodec.hpp"
+#include "com/ProgressEngine.hpp"
 #include "com/Request.hpp"
 #include "logging/LogMacros.hpp"
 #include "m2n/DistributedCommunication.hpp"
@@ -290,9 +292,13 @@ std::map<int, std::vector<int>> buildCommunicationMap(
 
 PointToPointCommunication::PointToPointCommunication(
     com::PtrCommunicationFactory communicationFactory,
-    mesh::PtrMesh                mesh)
+    mesh::PtrMesh                mesh,
+    bool                         useProgressThread,
+    com::PayloadCodec            codec)
     : DistributedCommunication(std::move(mesh)),
-      _communicationFactory(std::move(communicationFactory))
+      _communicationFactory(std::move(communicationFactory)),
+      _useProgressThread(useProgressThread),
+      _codec(codec)
 {
 }
 
@@ -583,6 +589,7 @@ void PointToPointCommunication::closeConnection()
     return;
 
   checkBufferedRequests(true);
+  _progressEngine.reset();
 
   _communication.reset();
   _mappings.clear();
@@ -591,21 +598,41 @@ void PointToPointCommunication::closeConnection()
 }
 
 void PointToPointCommunication::send(precice::span<double const> itemsToSend, int valueDimension)
+{
+  send(itemsToSend, valueDimension, {});
+}
+
+void PointToPointCommunication::send(precice::span<double const> itemsToSend, int valueDimension, precice::span<double const> header)
 {
 
-  if (_mappings.empty() || itemsToSend.empty()) {
+  if (_mappings.empty() || (itemsToSend.empty() && header.empty())) {
     return;
   }
 
   for (auto &mapping : _mappings) {
     auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
+    buffer->reserve(header.size() + mapping.indices.size() * valueDimension);
+    buffer->insert(buffer->end(), header.begin(), header.end());
     for (auto index : mapping.indices) {
       for (int d = 0; d < valueDimension; ++d) {
         buffer->push_back(itemsToSend[index * valueDimension + d]);
       }
     }
-    auto request = _communication->aSend(span<const double>{*buffer}, mapping.remoteRank);
+    auto engine = progressEngine();
+    if (_codec != com::PayloadCodec::None) {
+      // The header tells the receiver the size of the encoded payload, which follows in a second message
+      buffer = std::make_shared<std::vector<double>>(com::encodePayload(_codec, *buffer));
+      auto header = _communication->aSend(span<const double>{buffer->data(), com::PayloadHeaderSize}, mapping.remoteRank);
+      if (engine) {
+        header = engine->add(std::move(header));
+      }
+      bufferedRequests.emplace_back(header, buffer);
+    }
+    const auto offset  = _codec != com::PayloadCodec::None ? com::PayloadHeaderSize : 0;
+    auto       request = _communication->aSend(span<const double>{*buffer}.subspan(offset), mapping.remoteRank);
+    if (engine) {
+      request = engine->add(std::move(request));
+    }
     bufferedRequests.emplace_back(request, buffer);
   }
   checkBufferedRequests(false);
@@ -613,28 +640,139 @@ void PointToPointCommunication::send(precice::span<double const> itemsToSend, in
 
 void PointToPointCommunication::receive(precice::span<double> itemsToReceive, int valueDimension)
 {
-  if (_mappings.empty() || itemsToReceive.empty()) {
-    return;
-  }
+  receive(itemsToReceive, valueDimension, {});
+}
 
-  std::fill(itemsToReceive.begin(), itemsToReceive.end(), 0.0);
+void PointToPointCommunication::receive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header)
+{
+  postReceive(itemsToReceive, valueDimension, header)->wait();
+}
 
-  for (auto &mapping : _mappings) {
-    mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
-    mapping.request = _communication->aReceive(span<double>{mapping.recvBuffer}, mapping.remoteRank);
+com::PtrRequest PointToPointCommunication::aReceive(precice::span<double> itemsToReceive, int valueDimension)
+{
+  return postReceive(itemsToReceive, valueDimension, {});
+}
+
+/// Accumulates the subsets received from the remote ranks into the local values
+class PointToPointCommunication::ReceiveRequest : public com::Request {
+public:
+  ReceiveRequest(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header, com::PayloadCodec codec)
+      : _itemsToReceive(itemsToReceive),
+        _valueDimension(valueDimension),
+        _header(header),
+        _codec(codec)
+  {
   }
 
-  for (auto &mapping : _mappings) {
-    mapping.request->wait();
+  /// Adds the mapping, whose request is posted, and which is accumulated here unless done by a progress engine
+  void add(Mapping &mapping, bool accumulateOnCompletion)
+  {
+    _pending.push_back({&mapping, accumulateOnCompletion});
+  }
 
-    int i = 0;
+  void accumulate(Mapping &mapping)
+  {
+    if (_codec != com::PayloadCodec::None) {
+      com::decodePayload(mapping.payload, mapping.recvBuffer);
+    }
+    // All remote ranks send the same header
+    std::copy_n(mapping.recvBuffer.begin(), _header.size(), _header.begin());
+    const double *values = mapping.recvBuffer.data() + _header.size();
+    int           i      = 0;
     for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
+      for (int d = 0; d < _valueDimension; ++d) {
+        _itemsToReceive[index * _valueDimension + d] += values[i * _valueDimension + d];
       }
       i++;
     }
   }
+
+  bool test() override
+  {
+    for (auto pending = _pending.begin(); pending != _pending.end();) {
+      if (pending->mapping->request->test()) {
+        if (pending->accumulateOnCompletion) {
+          accumulate(*pending->mapping);
+        }
+        pending = _pending.erase(pending);
+      } else {
+        ++pending;
+      }
+    }
+    return _pending.empty();
+  }
+
+  void wait() override
+  {
+    // Accumulate what arrived already before waiting for the rest
+    test();
+    for (const auto &pending : _pending) {
+      pending.mapping->request->wait();
+      if (pending.accumulateOnCompletion) {
+        accumulate(*pending.mapping);
+      }
+    }
+    _pending.clear();
+  }
+
+private:
+  struct Pending {
+    Mapping *mapping;
+    bool     accumulateOnCompletion;
+  };
+
+  precice::span<double> _itemsToReceive;
+
+  int _valueDimension;
+
+  precice::span<double> _header;
+
+  com::PayloadCodec _codec;
+
+  /// Mappings whose data did not arrive yet
+  std::vector<Pending> _pending;
+};
+
+com::PtrRequest PointToPointCommunication::postReceive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header)
+{
+  if (_pendingReceive) {
+    _pendingReceive->wait();
+    _pendingReceive.reset();
+  }
+
+  if (_mappings.empty() || (itemsToReceive.empty() && header.empty())) {
+    return std::make_shared<com::CompletedRequest>();
+  }
+
+  std::fill(itemsToReceive.begin(), itemsToReceive.end(), 0.0);
+
+  // The progress engine accumulates the received data as soon as it arrives
+  auto engine  = progressEngine();
+  auto request = std::make_shared<ReceiveRequest>(itemsToReceive, valueDimension, header, _codec);
+  for (auto &mapping : _mappings) {
+    mapping.recvBuffer.resize(header.size() + mapping.indices.size() * valueDimension);
+    span<double> target{mapping.recvBuffer};
+    if (_codec != com::PayloadCodec::None) {
+      // Receive the header first to allocate the encoded payload
+      mapping.payload.resize(com::PayloadHeaderSize);
+      _communication->receive(span<double>{mapping.payload}, mapping.remoteRank);
+      mapping.payload.resize(com::PayloadHeaderSize + com::payloadSize(mapping.payload));
+      target = span<double>{mapping.payload}.subspan(com::PayloadHeaderSize);
+    }
+    mapping.request = _communication->aReceive(target, mapping.remoteRank);
+    if (engine) {
+      mapping.request = engine->add(std::move(mapping.request), [request, &mapping] { request->accumulate(mapping); });
+    }
+    request->add(mapping, engine == nullptr);
+  }
+
+  _pendingReceive = request;
+  return request;
+}
+
+bool PointToPointCommunication::receivesHeader() const
+{
+  return not _mappings.empty();
 }
 
 void PointToPointCommunication::broadcastSend(int itemToSend)
@@ -683,6 +821,14 @@ void PointToPointCommunication::gatherAllCommunicationMap(CommunicationMap &loca
   }
 }
 
+com::ProgressEngine *PointToPointCommunication::progressEngine()
+{
+  if (_useProgressThread && not _progressEngine) {
+    _progressEngine = std::make_unique<com::ProgressEngine>();
+  }
+  return _progressEngine.get();
+}
+
 void PointToPointCommunication::checkBufferedRequests(bool blocking)
 {
   PRECICE_TRACE(bufferedRequests.size());
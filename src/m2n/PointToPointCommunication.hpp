@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 #include "DistributedCommunication.hpp"
+#include "com/PayloadCodec.hpp"
+#include "com/ProgressEngine.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
@@ -31,8 +33,16 @@ namespace m2n {
  */
 class PointToPointCommunication : public DistributedCommunication {
 public:
+  /**
+   * @param[in] communicationFactory the factory for the communication between the ranks
+   * @param[in] mesh the mesh to communicate data of
+   * @param[in] useProgressThread drive sends and receives in a background thread, see com::ProgressEngine
+   * @param[in] codec the codec of the data payloads, see com::encodePayload()
+   */
   PointToPointCommunication(com::PtrCommunicationFactory communicationFactory,
-                            mesh::PtrMesh                mesh);
+                            mesh::PtrMesh                mesh,
+                            bool                         useProgressThread = false,
+                            com::PayloadCodec            codec             = com::PayloadCodec::None);
 
   ~PointToPointCommunication() override;
 
@@ -101,6 +111,30 @@ public:
    */
   void receive(precice::span<double> itemsToReceive, int valueDimension = 1) override;
 
+  /**
+   * @brief Sends the subsets of local double values like send(), each one preceded by the header.
+   */
+  void send(precice::span<double const> itemsToSend, int valueDimension, precice::span<double const> header) override;
+
+  /**
+   * @brief Receives the subsets of local double values like receive() and the header preceding them.
+   */
+  void receive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header) override;
+
+  /// Returns true, if this rank exchanges data with any remote rank
+  bool receivesHeader() const override;
+
+  /**
+   * @brief Posts the receives of the subsets of local double values from all remote ranks.
+   *
+   * The subsets are accumulated in the order in which they arrive, while the returned request is tested or waited for,
+   * or in the background if the progress thread is used.
+   * The buffers per remote rank are reused, hence a previously posted receive is completed first.
+   *
+   * @note With compression, the size of the payload is received blocking before its receive is posted.
+   */
+  com::PtrRequest aReceive(precice::span<double> itemsToReceive, int valueDimension) override;
+
   /// Broadcasts an int to connected ranks on remote participant
   void broadcastSend(int itemToSend) override;
 
@@ -139,6 +173,8 @@ private:
    **/
   com::PtrCommunication _communication;
 
+  class ReceiveRequest;
+
   /**
    * @brief Defines mapping between:
    *        1. global remote process rank;
@@ -153,6 +189,8 @@ private:
     std::vector<int>    indices;
     com::PtrRequest     request;
     std::vector<double> recvBuffer;
+    /// Encoded payload received, if a codec is used
+    std::vector<double> payload;
   };
 
   /**
@@ -181,6 +219,22 @@ private:
 
   bool _isConnected = false;
 
+  bool _useProgressThread;
+
+  com::PayloadCodec _codec;
+
+  /// Drives the requests in the background, if enabled
+  std::unique_ptr<com::ProgressEngine> _progressEngine;
+
+  /// Receive posted by aReceive(), which may still use the buffers of the mappings
+  com::PtrRequest _pendingReceive;
+
+  /// Posts the receives of the subsets of local double values preceded by the header, see aReceive()
+  com::PtrRequest postReceive(precice::span<double> itemsToReceive, int valueDimension, precice::span<double> header);
+
+  /// Returns the progress engine, which is started on first use, or nullptr if disabled
+  com::ProgressEngine *progressEngine();
+
   std::list<std::pair<std::shared_ptr<com::Request>,
                       std::shared_ptr<std::vector<double>>>>
       bufferedRequests;
@@ -5,6 +5,7 @@
 #include "com/CommunicationFactory.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/PayloadCodec.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "logging/LogMacros.hpp"
@@ -13,6 +14,7 @@
 #include "m2n/M2N.hpp"
 #include "m2n/PointToPointComFactory.hpp"
 #include "utils/Helpers.hpp"
+#include "utils/Parallel.hpp"
 #include "utils/assertion.hpp"
 #include "utils/networking.hpp"
 #include "xml/ConfigParser.hpp"
@@ -107,6 +109,18 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   attrTwoLevel.setDocumentation("Use a two-level initialization scheme. "
                                 "Recommended for large parallel runs (>5000 MPI ranks).");
 
+  XMLAttribute<bool> attrProgressThread(ATTR_USE_PROGRESS_THREAD, false);
+  attrProgressThread.setDocumentation("Drive the point-to-point data exchange in a background thread, such that sends and receives "
+                                      "complete while the solver computes. This requires MPI_THREAD_MULTIPLE for MPI-based communication. "
+                                      "The thread occupies a core while it waits for messages.");
+
+  auto attrCompression = XMLAttribute<std::string>(ATTR_COMPRESSION, "none")
+                             .setOptions({"none", "lossless", "float32"})
+                             .setDocumentation("Compress the exchanged data to reduce the bytes on the wire. "
+                                               "\"lossless\" shuffles the bytes of the values and compresses runs of equal bytes. "
+                                               "\"float32\" additionally rounds the values to single precision, which is lossy. "
+                                               "Only recommended if the bandwidth between the participants is low.");
+
   auto attrFrom = XMLAttribute<std::string>("from")
                       .setDocumentation(
                           "First participant name involved in communication. For performance reasons, we recommend to use "
@@ -119,6 +133,8 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrTo);
     tag.addAttribute(attrEnforce);
     tag.addAttribute(attrTwoLevel);
+    tag.addAttribute(attrProgressThread);
+    tag.addAttribute(attrCompression);
     parent.addSubtag(tag);
   }
 }
@@ -152,6 +168,8 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     checkDuplicates(from, to);
     bool enforceGatherScatter = tag.getBooleanAttributeValue(ATTR_ENFORCE_GATHER_SCATTER);
     bool useTwoLevelInit      = tag.getBooleanAttributeValue(ATTR_USE_TWO_LEVEL_INIT);
+    bool useProgressThread    = tag.getBooleanAttributeValue(ATTR_USE_PROGRESS_THREAD);
+    auto codec                = com::payloadCodecFromString(tag.getStringAttributeValue(ATTR_COMPRESSION));
 
     if (enforceGatherScatter && useTwoLevelInit) {
       throw std::runtime_error{std::string{"A gather-scatter m2n communication cannot use two-level initialization. Please switch either "} + "\"" + ATTR_ENFORCE_GATHER_SCATTER + "\" or \"" + ATTR_USE_TWO_LEVEL_INIT + "\" off."};
@@ -205,11 +223,22 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
 
     PRECICE_ASSERT(com.get() != nullptr);
 
+    if (useProgressThread && enforceGatherScatter) {
+      PRECICE_WARN("The m2n communication between \"{}\" and \"{}\" enforces a gather-scatter scheme, which does not use a progress thread.", from, to);
+      useProgressThread = false;
+    }
+    if (useProgressThread && tagName != "sockets" && not utils::Parallel::allowsConcurrentCommunication()) {
+      PRECICE_WARN("The m2n communication between \"{}\" and \"{}\" cannot use a progress thread, as MPI does not provide MPI_THREAD_MULTIPLE. "
+                   "Please initialize MPI with MPI_THREAD_MULTIPLE or let preCICE initialize MPI.",
+                   from, to);
+      useProgressThread = false;
+    }
+
     DistributedComFactory::SharedPointer distrFactory;
     if (enforceGatherScatter) {
-      distrFactory = std::make_shared<GatherScatterComFactory>(com);
+      distrFactory = std::make_shared<GatherScatterComFactory>(com, codec);
     } else {
-      distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
+      distrFactory = std::make_shared<PointToPointComFactory>(comFactory, useProgressThread, codec);
     }
     PRECICE_ASSERT(distrFactory.get() != nullptr);
 
@@ -80,6 +80,61 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest)
   }
 }
 
+BOOST_AUTO_TEST_CASE(GatherScatterHeaderTest)
+{
+  PRECICE_TEST("Part1"_on(1_rank), "Part2"_on(3_ranks).setupIntraComm(), Require::Events);
+  auto m2n = context.connectPrimaryRanks("Part1", "Part2");
+
+  int dimensions       = 2;
+  int numberOfVertices = 6;
+  int valueDimension   = 1;
+
+  mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", dimensions, testing::nextMeshID()));
+  m2n->createDistributedCommunication(pMesh);
+
+  if (context.isNamed("Part1")) {
+    pMesh->setGlobalNumberOfVertices(numberOfVertices);
+    pMesh->setVertexDistribution({{0, {0, 1, 2, 3, 4, 5}}});
+    m2n->acceptSecondaryRanksConnection("Part1", "Part2");
+
+    Eigen::VectorXd values(numberOfVertices);
+    values << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+    Eigen::Vector2d header(0.5, 42.0);
+    for (int i = 0; i < 2; ++i) {
+      m2n->send(values, pMesh->getID(), valueDimension, header);
+      header *= 2;
+    }
+
+    double received = 0.0;
+    m2n->receive(values, pMesh->getID(), valueDimension, {&received, 1});
+    BOOST_TEST(received == 7.0);
+    BOOST_TEST(values(5) == 6.0);
+  } else {
+    BOOST_TEST(context.isNamed("Part2"));
+    m2n->requestSecondaryRanksConnection("Part1", "Part2");
+    if (context.isPrimary()) {
+      pMesh->setGlobalNumberOfVertices(numberOfVertices);
+      pMesh->setVertexDistribution({{0, {0, 1, 3}}, {2, {2, 3, 4, 5}}});
+    }
+
+    // Only the primary rank receives the header with the data, it broadcasts the header to the secondary ranks
+    Eigen::VectorXd values = Eigen::VectorXd::Zero(context.isRank(0) ? 3 : (context.isRank(2) ? 4 : 0));
+    Eigen::Vector2d header(0.0, 0.0);
+    m2n->receive(values, pMesh->getID(), valueDimension, header);
+    BOOST_TEST(header(0) == 0.5);
+    BOOST_TEST(header(1) == 42.0);
+    m2n->receive(values, pMesh->getID(), valueDimension, header);
+    BOOST_TEST(header(0) == 1.0);
+    BOOST_TEST(header(1) == 84.0);
+    if (context.isRank(2)) {
+      BOOST_TEST(values(3) == 6.0);
+    }
+
+    const double sent = 7.0;
+    m2n->send(values, pMesh->getID(), valueDimension, {&sent, 1});
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // PRECICE_NO_MPI
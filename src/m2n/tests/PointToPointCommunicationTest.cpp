@@ -6,6 +6,8 @@
 #include <memory>
 #include <vector>
 #include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/PayloadCodec.hpp"
+#include "com/Request.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/DistributedCommunication.hpp"
@@ -43,13 +45,13 @@ void process(vector<double> &data)
   }
 }
 
-void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
+void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf, bool useProgressThread = false, com::PayloadCodec codec = com::PayloadCodec::None)
 {
   BOOST_TEST(context.hasSize(2));
 
   mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
 
-  m2n::PointToPointCommunication c(cf, mesh);
+  m2n::PointToPointCommunication c(cf, mesh, useProgressThread, codec);
 
   vector<double> data;
   vector<double> expectedData;
@@ -99,6 +101,51 @@ void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
   }
 }
 
+/// Posts two receives on the same connection, the second one completes the first one
+void runP2PComAsyncReceiveTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  if (context.isNamed("A")) {
+    if (context.isPrimary()) {
+      mesh->setGlobalNumberOfVertices(4);
+      mesh->setVertexDistribution({{0, {0, 1}}, {1, {1, 2, 3}}});
+    }
+    vector<double> data = context.isPrimary() ? vector<double>{1, 2} : vector<double>{20, 30, 40};
+
+    c.requestConnection("B", "A");
+    c.send(data);
+    process(data);
+    c.send(data);
+  } else {
+    BOOST_TEST(context.isNamed("B"));
+    if (context.isPrimary()) {
+      mesh->setGlobalNumberOfVertices(4);
+      mesh->setVertexDistribution({{0, {0, 1, 3}}, {1, {2}}});
+    }
+    vector<double> first(context.isPrimary() ? 3 : 1, -1);
+    vector<double> second(first.size(), -1);
+
+    c.acceptConnection("B", "A");
+    auto firstRequest  = c.aReceive(first, 1);
+    auto secondRequest = c.aReceive(second, 1);
+    BOOST_TEST(firstRequest->test());
+    secondRequest->wait();
+
+    if (context.isPrimary()) {
+      BOOST_TEST(testing::equals(first, vector<double>{1, 22, 40}));
+      BOOST_TEST(testing::equals(second, vector<double>{2, 25, 42}));
+    } else {
+      BOOST_TEST(testing::equals(first, vector<double>{30}));
+      BOOST_TEST(testing::equals(second, vector<double>{32}));
+    }
+  }
+}
+
 /// a very similar test, but with a vertex that has been completely filtered out
 void runP2PComTest2(const TestContext &context, com::PtrCommunicationFactory cf)
 {
@@ -468,6 +515,27 @@ BOOST_AUTO_TEST_CASE(P2PComTest1)
   runP2PComTest1(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(P2PComTest1ProgressThread)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComTest1(context, cf, true);
+}
+
+BOOST_AUTO_TEST_CASE(P2PComTest1Lossless)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComTest1(context, cf, false, com::PayloadCodec::Lossless);
+}
+
+BOOST_AUTO_TEST_CASE(P2PComAsyncReceiveTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComAsyncReceiveTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(P2PComTest2)
 {
   PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
@@ -8,7 +8,6 @@
 
 #include "logging/LogMacros.hpp"
 #include "mapping/BarycentricBaseMapping.hpp"
-#include "mapping/Polation.hpp"
 #include "math/differences.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
@@ -32,7 +31,7 @@ BarycentricBaseMapping::BarycentricBaseMapping(Constraint constraint, int dimens
 void BarycentricBaseMapping::clear()
 {
   PRECICE_TRACE();
-  _interpolations.clear();
+  _operator.clear();
   _hasComputedMapping = false;
 }
 
@@ -42,26 +41,14 @@ void BarycentricBaseMapping::mapConservative(DataID inputDataID, DataID outputDa
   precice::utils::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
   PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
   PRECICE_DEBUG("Map conservative");
-  PRECICE_ASSERT(_interpolations.size() == input()->vertices().size(),
-                 _interpolations.size(), input()->vertices().size());
+  PRECICE_ASSERT(_operator.rows() == output()->vertices().size(),
+                 _operator.rows(), output()->vertices().size());
   const int              dimensions = input()->data(inputDataID)->getDimensions();
   const Eigen::VectorXd &inValues   = input()->data(inputDataID)->values();
   Eigen::VectorXd &      outValues  = output()->data(outputDataID)->values();
 
-  // For each input vertex, distribute the conserved data among the relevant output vertices
-  // Do it for all dimensions (i.e. components if data is a vector)
-  for (size_t i = 0; i < input()->vertices().size(); i++) {
-    const size_t inOffset = i * dimensions;
-    const auto & elems    = _interpolations[i].getWeightedElements();
-    for (const auto &elem : elems) {
-      size_t outOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-      for (int dim = 0; dim < dimensions; dim++) {
-        PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-        PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-        outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-      }
-    }
-  }
+  // The transposed interpolations collect the conserved data of all relevant input vertices per output vertex
+  _operator.multiply(inValues, outValues, dimensions);
 }
 
 void BarycentricBaseMapping::mapConsistent(DataID inputDataID, DataID outputDataID)
@@ -69,8 +56,8 @@ void BarycentricBaseMapping::mapConsistent(DataID inputDataID, DataID outputData
   PRECICE_TRACE(inputDataID, outputDataID);
   precice::utils::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
   PRECICE_DEBUG("Map consistent");
-  PRECICE_ASSERT(_interpolations.size() == output()->vertices().size(),
-                 _interpolations.size(), output()->vertices().size());
+  PRECICE_ASSERT(_operator.rows() == output()->vertices().size(),
+                 _operator.rows(), output()->vertices().size());
 
   const int              dimensions = input()->data(inputDataID)->getDimensions();
   const Eigen::VectorXd &inValues   = input()->data(inputDataID)->values();
@@ -78,18 +65,7 @@ void BarycentricBaseMapping::mapConsistent(DataID inputDataID, DataID outputData
 
   // For each output vertex, compute the linear combination of input vertices
   // Do it for all dimensions (i.e. components if data is a vector)
-  for (size_t i = 0; i < output()->vertices().size(); i++) {
-    const auto &elems     = _interpolations[i].getWeightedElements();
-    size_t      outOffset = i * dimensions;
-    for (const auto &elem : elems) {
-      const size_t inOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-      for (int dim = 0; dim < dimensions; dim++) {
-        PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-        PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-        outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-      }
-    }
-  }
+  _operator.multiply(inValues, outValues, dimensions);
 }
 
 void BarycentricBaseMapping::tagMeshFirstRound()
@@ -114,17 +90,13 @@ void BarycentricBaseMapping::tagMeshFirstRound()
   std::unordered_set<int> tagged;
   const std::size_t       max_count = origins->vertices().size();
 
-  for (const Polation &interpolation : _interpolations) {
-    for (const auto &elem : interpolation.getWeightedElements()) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.vertexID);
-      }
-    }
-    // Shortcut if all vertices are tagged
-    if (tagged.size() == max_count) {
-      break;
+  // The rows of a conservative operator correspond to the output vertices, its columns to the input vertices
+  const bool tagsRows = hasConstraint(CONSERVATIVE);
+  _operator.forEachEntry([&](std::size_t row, int column, double weight) {
+    if (tagged.size() < max_count && !math::equals(weight, 0.0)) {
+      tagged.insert(tagsRows ? static_cast<int>(row) : column);
     }
-  }
+  });
 
   // Now tag all vertices to be tagged in the second phase.
   for (auto &v : origins->vertices()) {
@@ -143,5 +115,17 @@ void BarycentricBaseMapping::tagMeshSecondRound()
   // for NP mapping no operation needed here
 }
 
+void BarycentricBaseMapping::finishOperator()
+{
+  if (hasConstraint(CONSERVATIVE)) {
+    _operator.transpose(output()->vertices().size());
+  }
+}
+
+bool BarycentricBaseMapping::isRankLocal() const
+{
+  return true;
+}
+
 } // namespace mapping
 } // namespace precice
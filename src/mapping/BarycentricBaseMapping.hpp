@@ -3,14 +3,14 @@
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
-#include "mapping/Polation.hpp"
+#include "mapping/SparseOperator.hpp"
 
 namespace precice {
 namespace mapping {
 
 /**
  * @brief Base class for interpolation based mappings, where mapping is done using a geometry-based linear combination of input values.
- *  Subclasses differ by the way computeMapping() fills the _interpolations and by mesh tagging. Mapping itself is shared.
+ *  Subclasses differ by the way computeMapping() fills the _operator and by mesh tagging. Mapping itself is shared.
  */
 class BarycentricBaseMapping : public Mapping {
 public:
@@ -22,6 +22,9 @@ public:
   void tagMeshFirstRound() final override;
   void tagMeshSecondRound() final override;
 
+  /// The interpolations only use data of this rank
+  bool isRankLocal() const final override;
+
 private:
   logging::Logger _log{"mapping::BarycentricBaseMapping"};
 
@@ -32,7 +35,15 @@ protected:
   /// @copydoc Mapping::mapConsistent
   void mapConsistent(DataID inputDataID, DataID outputDataID) override;
 
-  std::vector<Polation> _interpolations;
+  /**
+   * @brief Weights of the interpolations, one row per origin vertex while computing the mapping.
+   *
+   * Subclasses append the row of each origin vertex in computeMapping() and call finishOperator() afterwards.
+   */
+  SparseOperator _operator;
+
+  /// Transposes the operator of a conservative mapping, such that each row corresponds to an output vertex
+  void finishOperator();
 };
 
 } // namespace mapping
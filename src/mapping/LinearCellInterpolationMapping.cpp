@@ -76,19 +76,20 @@ void LinearCellInterpolationMapping::computeMapping()
   auto &                                 index = searchSpace->index();
   utils::statistics::DistanceAccumulator fallbackStatistics;
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  _operator.clear();
+  _operator.reserve(fVertices.size(), fVertices.size() * (getDimensions() + 1));
 
   for (const auto &fVertex : fVertices) {
     // Find tetrahedra (3D) or triangle (2D) or fall-back on NP
     auto match    = index.findCellOrProjection(fVertex.getCoords(), nnearest);
     auto distance = match.polation.distance();
-    _interpolations.push_back(std::move(match.polation));
+    _operator.appendRow(match.polation.getWeightedElements());
     if (!math::equals(distance, 0.0)) {
       // Only push when fall-back occurs, so the number of entries is the number of vertices outside the domain
       fallbackStatistics(distance);
     }
   }
+  finishOperator();
 
   if (!fallbackStatistics.empty() && !missingConnectivity) {
     PRECICE_INFO(
@@ -86,6 +86,11 @@ bool Mapping::requiresGradientData() const
   return _requiresGradientData;
 }
 
+bool Mapping::isRankLocal() const
+{
+  return false;
+}
+
 void Mapping::map(int inputDataID,
                   int outputDataID)
 {
@@ -159,6 +164,12 @@ bool Mapping::hasComputedMapping() const
   return _hasComputedMapping;
 }
 
+void Mapping::updateMapping(const mesh::Mesh &mesh, const std::vector<VertexID> &movedVertices)
+{
+  PRECICE_ASSERT(&mesh == input().get() || &mesh == output().get(), mesh.getName());
+  clear();
+}
+
 bool operator<(Mapping::MeshRequirement lhs, Mapping::MeshRequirement rhs)
 {
   switch (lhs) {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <iosfwd>
+#include <vector>
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "precice/types.hpp"
 
 namespace precice {
 namespace mapping {
@@ -93,6 +95,17 @@ public:
   /// Removes a computed mapping.
   virtual void clear() = 0;
 
+  /**
+   * @brief Updates a computed mapping after vertices of the input or output mesh moved.
+   *
+   * By default, the computed mapping is removed and needs to be recomputed.
+   * Mappings which can update their coefficients locally override this.
+   *
+   * @param[in] mesh The input or output mesh of the mapping, whose vertices moved.
+   * @param[in] movedVertices The IDs of the moved vertices.
+   */
+  virtual void updateMapping(const mesh::Mesh &mesh, const std::vector<VertexID> &movedVertices);
+
   /**
    * @brief Maps input data to output data from input mesh to output mesh.
    *
@@ -122,6 +135,14 @@ public:
   /// Returns whether the mapping requires gradient data
   bool requiresGradientData() const;
 
+  /**
+   * @brief Returns true, if map() only accesses data of this rank and does not communicate.
+   *
+   * Such mappings may be executed concurrently for different input and output data.
+   * Hence, map() must not modify the state of the mapping.
+   */
+  virtual bool isRankLocal() const;
+
 protected:
   /// Returns pointer to input mesh.
   mesh::PtrMesh input() const;
@@ -59,10 +59,10 @@ void NearestNeighborBaseMapping::computeMapping()
   // Needed for error calculations
   utils::statistics::DistanceAccumulator distanceStatistics;
 
-  auto &index = searchSpace->index();
+  const auto matchedVertices = searchSpace->index().getClosestVertices(sourceVertices);
   for (size_t i = 0; i < verticesSize; ++i) {
     const auto &sourceCoords  = sourceVertices[i].getCoords();
-    const auto &matchedVertex = index.getClosestVertex(sourceCoords);
+    const auto &matchedVertex = matchedVertices[i];
     _vertexIndices[i]         = matchedVertex.index;
 
     // Compute distance between input and output vertiex for the stats
@@ -71,6 +71,8 @@ void NearestNeighborBaseMapping::computeMapping()
     distanceStatistics(distance);
   }
 
+  compileOperator();
+
   // For gradient mapping, the calculation of offsets between source and matched vertex necessary
   onMappingComputed(origins, searchSpace);
 
@@ -89,10 +91,11 @@ void NearestNeighborBaseMapping::clear()
 {
   PRECICE_TRACE();
   _vertexIndices.clear();
+  _operator.clear();
   _hasComputedMapping = false;
 
   if (requiresGradientData())
-    _offsetsMatched.clear();
+    _offsetsMatched.resize(0, 0);
 
   if (getConstraint() == CONSISTENT) {
     input()->index().clear();
@@ -101,6 +104,53 @@ void NearestNeighborBaseMapping::clear()
   }
 }
 
+void NearestNeighborBaseMapping::updateMapping(const mesh::Mesh &mesh, const std::vector<VertexID> &movedVertices)
+{
+  PRECICE_TRACE(mesh.getName(), movedVertices.size());
+  if (not _hasComputedMapping) {
+    return;
+  }
+
+  mesh::PtrMesh origins, searchSpace;
+  if (hasConstraint(CONSERVATIVE)) {
+    origins     = input();
+    searchSpace = output();
+  } else {
+    origins     = output();
+    searchSpace = input();
+  }
+
+  if (&mesh == searchSpace.get()) {
+    // Any match may change, but the index of the search space is not rebuilt
+    computeMapping();
+    return;
+  }
+  PRECICE_ASSERT(&mesh == origins.get(), mesh.getName());
+
+  precice::utils::Event e("map." + mappingNameShort + ".updateMapping.From" + input()->getName() + "To" + output()->getName());
+  auto &index = searchSpace->index();
+  for (auto id : movedVertices) {
+    _vertexIndices[id] = index.getClosestVertex(origins->vertices()[id].getCoords()).index;
+  }
+  compileOperator();
+
+  // For gradient mapping, the offsets between the moved vertices and their matches changed
+  onMappingComputed(origins, searchSpace);
+}
+
+void NearestNeighborBaseMapping::compileOperator()
+{
+  _operator.clear();
+  _operator.reserve(_vertexIndices.size(), _vertexIndices.size());
+  for (int index : _vertexIndices) {
+    _operator.appendRow(index, 1.0);
+  }
+  // Conservative mappings match each input vertex, the transposed operator has one row per output vertex
+  if (hasConstraint(CONSERVATIVE)) {
+    _operator.transpose(output()->vertices().size());
+  }
+}
+
 void NearestNeighborBaseMapping::onMappingComputed(mesh::PtrMesh origins, mesh::PtrMesh searchSpace)
 {
   // Does nothing by default
@@ -135,5 +185,10 @@ void NearestNeighborBaseMapping::tagMeshSecondRound()
   // for NN mapping no operation needed here
 }
 
+bool NearestNeighborBaseMapping::isRankLocal() const
+{
+  return true;
+}
+
 } // namespace mapping
 } // namespace precice
@@ -4,6 +4,7 @@
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/SparseOperator.hpp"
 
 namespace precice {
 namespace mapping {
@@ -27,6 +28,14 @@ public:
   /// Removes a computed mapping.
   void clear() final override;
 
+  /**
+   * @brief Updates the computed mapping after vertices moved.
+   *
+   * Only the matches of moved vertices are recomputed if they are the origins of the mapping.
+   * If vertices of the search space moved, all matches are recomputed using the incrementally updated index.
+   */
+  void updateMapping(const mesh::Mesh &mesh, const std::vector<VertexID> &movedVertices) final override;
+
   /**
    * Matches the offsets needed for the gradient mapping
    * Does nothing by default
@@ -36,6 +45,9 @@ public:
   void tagMeshFirstRound() final override;
   void tagMeshSecondRound() final override;
 
+  /// The matched vertices are always vertices of this rank
+  bool isRankLocal() const final override;
+
 protected:
   /// NearestNeighborMapping or NearestNeighborGradientMapping
   std::string mappingName;
@@ -45,12 +57,18 @@ protected:
 
   mutable logging::Logger _log{"mapping::" + mappingName};
 
-  /// Compute the vector offset between the matched vector and the source vector (needed for gradient mapping)
-  /// Optimization: save this as an std::vector<double> and use an Eigen::Map to create an interface that uses the correct dimensions.
-  std::vector<Eigen::VectorXd> _offsetsMatched;
+  /// Compute the vector offset between the matched vector and the source vector (needed for gradient mapping), one column per origin vertex
+  Eigen::MatrixXd _offsetsMatched;
 
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
+
+  /// The matches as operator with unit weights, one row per output vertex
+  SparseOperator _operator;
+
+private:
+  /// Compiles the _vertexIndices into the _operator
+  void compileOperator();
 };
 
 } // namespace mapping
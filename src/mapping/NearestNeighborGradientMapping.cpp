@@ -8,6 +8,7 @@
 #include "logging/LogMacros.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Event.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -39,7 +40,7 @@ void NearestNeighborGradientMapping::onMappingComputed(mesh::PtrMesh origins, me
 {
 
   // Initialize the offsets list
-  _offsetsMatched.resize(_vertexIndices.size());
+  _offsetsMatched.resize(getDimensions(), _vertexIndices.size());
 
   // Calculate offsets
   for (size_t i = 0; i < _vertexIndices.size(); ++i) {
@@ -50,7 +51,7 @@ void NearestNeighborGradientMapping::onMappingComputed(mesh::PtrMesh origins, me
     // We calculate the distances uniformly for consistent mapping constraint as the difference (output - input)
     // For consistent mapping: the source is the output vertex and the matched vertex is the input since we iterate over all outputs
     // and assign each exactly one vertex form the search space, which are our origins vertices.
-    _offsetsMatched[i] = sourceVertexCoords - matchedVertexCoords;
+    _offsetsMatched.col(i) = sourceVertexCoords - matchedVertexCoords;
   }
 };
 
@@ -76,17 +77,17 @@ void NearestNeighborGradientMapping::mapConsistent(DataID inputDataID, DataID ou
   PRECICE_DEBUG((hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent"));
   const size_t outSize = output()->vertices().size();
 
-  for (size_t i = 0; i < outSize; i++) {
-    int inputIndex = _vertexIndices[i] * valueDimensions;
-
-    for (int dim = 0; dim < valueDimensions; dim++) {
-
-      const int mapOutputIndex = (i * valueDimensions) + dim;
-      const int mapInputIndex  = inputIndex + dim;
-
-      outputValues(mapOutputIndex) = inputValues(mapInputIndex) + _offsetsMatched[i].transpose() * gradientValues.col(mapInputIndex);
+  // The values of the matched vertices, corrected by the gradient along the offset
+  outputValues.setZero();
+  _operator.multiply(inputValues, outputValues, valueDimensions);
+  utils::parallelFor(0, outSize, 1024, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      const int inputIndex = _vertexIndices[i] * valueDimensions;
+      for (int dim = 0; dim < valueDimensions; dim++) {
+        outputValues(i * valueDimensions + dim) += _offsetsMatched.col(i).dot(gradientValues.col(inputIndex + dim));
+      }
     }
-  }
+  });
 
   PRECICE_DEBUG("Mapped values (with gradient) = {}", utils::previewRange(3, outputValues));
 }
@@ -38,20 +38,10 @@ void NearestNeighborMapping::mapConservative(DataID inputDataID, DataID outputDa
   Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
 
   // Data dimensions (for scalar = 1, for vectors > 1)
-  const int    valueDimensions = input()->data(inputDataID)->getDimensions();
-  const size_t inSize          = input()->vertices().size();
+  const int valueDimensions = input()->data(inputDataID)->getDimensions();
 
-  for (size_t i = 0; i < inSize; i++) {
-    int const outputIndex = _vertexIndices[i] * valueDimensions;
-
-    for (int dim = 0; dim < valueDimensions; dim++) {
-
-      const int mapOutputIndex = outputIndex + dim;
-      const int mapInputIndex  = (i * valueDimensions) + dim;
-
-      outputValues(mapOutputIndex) += inputValues(mapInputIndex);
-    }
-  }
+  // Each output vertex collects the values of all input vertices matching it
+  _operator.multiply(inputValues, outputValues, valueDimensions);
   PRECICE_DEBUG("Mapped values = {}", utils::previewRange(3, outputValues));
 }
 
@@ -65,20 +55,11 @@ void NearestNeighborMapping::mapConsistent(DataID inputDataID, DataID outputData
   Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
 
   // Data dimensions (for scalar = 1, for vectors > 1)
-  const int    valueDimensions = input()->data(inputDataID)->getDimensions();
-  const size_t outSize         = output()->vertices().size();
+  const int valueDimensions = input()->data(inputDataID)->getDimensions();
 
-  for (size_t i = 0; i < outSize; i++) {
-    int inputIndex = _vertexIndices[i] * valueDimensions;
-
-    for (int dim = 0; dim < valueDimensions; dim++) {
-
-      const int mapOutputIndex = (i * valueDimensions) + dim;
-      const int mapInputIndex  = inputIndex + dim;
-
-      outputValues(mapOutputIndex) = inputValues(mapInputIndex);
-    }
-  }
+  // Each output vertex takes the values of its matched input vertex
+  outputValues.setZero();
+  _operator.multiply(inputValues, outputValues, valueDimensions);
   PRECICE_DEBUG("Mapped values = {}", utils::previewRange(3, outputValues));
 }
 
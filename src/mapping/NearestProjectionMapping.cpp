@@ -84,8 +84,8 @@ void NearestProjectionMapping::computeMapping()
 
   utils::statistics::DistanceAccumulator distanceStatistics;
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  _operator.clear();
+  _operator.reserve(fVertices.size(), fVertices.size() * getDimensions());
 
   auto &index = searchSpace->index();
   for (const auto &fVertex : fVertices) {
@@ -93,8 +93,9 @@ void NearestProjectionMapping::computeMapping()
     // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
     auto match = index.findNearestProjection(fVertex.getCoords(), nnearest);
     distanceStatistics(match.polation.distance());
-    _interpolations.push_back(std::move(match.polation));
+    _operator.appendRow(match.polation.getWeightedElements());
   }
+  finishOperator();
 
   if (distanceStatistics.empty()) {
     PRECICE_INFO("Mapping distance not available due to empty partition.");
@@ -2,6 +2,8 @@
 
 #include <Eigen/Cholesky>
 #include <Eigen/Core>
+#include <map>
+#include <utility>
 
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
@@ -39,13 +41,20 @@ public:
    * @param[in] dimensions Dimensionality of the meshes
    * @param[in] function Radial basis function used for mapping.
    * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] polynomial Treatment of the polynomial
+   * @param[in] evaluation Evaluation of the interpolant at the output mesh
+   * @param[in] solver Solver of the interpolation system
+   * @param[in] solverRtol Relative tolerance of the iterative solver
    */
   RadialBasisFctMapping(
       Mapping::Constraint     constraint,
       int                     dimensions,
       RADIAL_BASIS_FUNCTION_T function,
       std::array<bool, 3>     deadAxis,
-      Polynomial              polynomial);
+      Polynomial              polynomial,
+      RBFEvaluation           evaluation = RBFEvaluation::MATRIX,
+      RBFSolver               solver     = RBFSolver::DIRECT,
+      double                  solverRtol = 1e-9);
 
   /// Computes the mapping coefficients from the in- and output mesh.
   void computeMapping() final override;
@@ -65,6 +74,18 @@ private:
 
   /// Treatment of the polynomial
   Polynomial _polynomial;
+
+  /// Evaluation of the interpolant at the output mesh
+  RBFEvaluation _evaluation;
+
+  /// Solver of the interpolation system
+  RBFSolver _solver;
+
+  /// Relative tolerance of the iterative solver
+  double _solverRtol;
+
+  /// Coefficients of the previous mapping per data and component, which are the initial guesses of the iterative solver
+  std::map<std::pair<DataID, int>, Eigen::VectorXd> _previousCoefficients;
 };
 
 // --------------------------------------------------- HEADER IMPLEMENTATIONS
@@ -75,9 +96,15 @@ RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctMapping(
     int                     dimensions,
     RADIAL_BASIS_FUNCTION_T function,
     std::array<bool, 3>     deadAxis,
-    Polynomial              polynomial)
+    Polynomial              polynomial,
+    RBFEvaluation           evaluation,
+    RBFSolver               solver,
+    double                  solverRtol)
     : RadialBasisFctBaseMapping<RADIAL_BASIS_FUNCTION_T>(constraint, dimensions, function, deadAxis),
-      _polynomial(polynomial)
+      _polynomial(polynomial),
+      _evaluation(evaluation),
+      _solver(solver),
+      _solverRtol(solverRtol)
 {
   PRECICE_CHECK(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
 }
@@ -146,7 +173,8 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
 
     _rbfSolver = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{this->_basisFunction, globalInMesh, boost::irange<Eigen::Index>(0, globalInMesh.vertices().size()),
-                                                               globalOutMesh, boost::irange<Eigen::Index>(0, globalOutMesh.vertices().size()), this->_deadAxis, _polynomial};
+                                                               globalOutMesh, boost::irange<Eigen::Index>(0, globalOutMesh.vertices().size()), this->_deadAxis, _polynomial, _evaluation, _solver, _solverRtol};
+    _previousCoefficients.clear();
   }
   this->_hasComputedMapping = true;
   PRECICE_DEBUG("Compute Mapping is Completed.");
@@ -157,6 +185,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
 {
   PRECICE_TRACE();
   _rbfSolver.clear();
+  _previousCoefficients.clear();
   this->_hasComputedMapping = false;
 }
 
@@ -220,7 +249,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(DataID inpu
     // Construct Eigen vectors
     Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
     Eigen::VectorXd             outputValues((this->output()->getGlobalNumberOfVertices()) * valueDim);
-    Eigen::VectorXd             in(_rbfSolver.getEvaluationMatrix().rows()); // rows == outputSize
+    Eigen::VectorXd             in(_rbfSolver.getOutputSize());
     outputValues.setZero();
 
     for (int dim = 0; dim < valueDim; dim++) {
@@ -228,7 +257,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(DataID inpu
         in[i] = inputValues(i * valueDim + dim);
       }
 
-      Eigen::VectorXd out = _rbfSolver.solveConservative(in, _polynomial);
+      Eigen::VectorXd out = _rbfSolver.solveConservative(in, _polynomial, &_previousCoefficients[{inputDataID, dim}]);
 
       // Copy mapped data to output data values
       for (int i = 0; i < this->output()->getGlobalNumberOfVertices(); i++) {
@@ -327,13 +356,13 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(DataID inputD
       outValuesSize.push_back(this->output()->data(outputDataID)->values().size());
     }
 
-    Eigen::VectorXd in(_rbfSolver.getEvaluationMatrix().cols()); // rows == n
+    Eigen::VectorXd in(_rbfSolver.getInputSize()); // n including polynomial parameters
     in.setZero();
 
     // Construct Eigen vectors
     Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
 
-    Eigen::VectorXd outputValues((_rbfSolver.getEvaluationMatrix().rows()) * valueDim);
+    Eigen::VectorXd outputValues(_rbfSolver.getOutputSize() * valueDim);
     Eigen::VectorXd out;
     outputValues.setZero();
 
@@ -344,7 +373,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(DataID inputD
         in[i] = inputValues[i * valueDim + dim];
       }
 
-      out = _rbfSolver.solveConsistent(in, _polynomial);
+      out = _rbfSolver.solveConsistent(in, _polynomial, &_previousCoefficients[{inputDataID, dim}]);
 
       // Copy mapped data to output data values
       for (int i = 0; i < out.size(); i++) {
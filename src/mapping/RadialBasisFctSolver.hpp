@@ -1,14 +1,22 @@
 #pragma once
 
 #include <Eigen/Cholesky>
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/QR>
+#include <Eigen/SparseCore>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/irange.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <numeric>
+#include "logging/LogMacros.hpp"
 #include "mapping/config/MappingConfiguration.hpp"
 #include "mesh/Mesh.hpp"
 #include "precice/types.hpp"
+#include "query/impl/KDTree.hpp"
 #include "utils/Event.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 namespace mapping {
@@ -18,6 +26,15 @@ namespace mapping {
  * The class uses a dense matrix decomposition in order to decompose the resulting system(s) and a backward substitution
  * in order to solve the system at runtime. The functionality uses Eigen and supports only serial execution. In case
  * the polynomial="separate" option is used, the polynomial system is solved using a QR decomposition.
+ *
+ * With RBFEvaluation::ON_THE_FLY, the evaluation matrix (output x input) is not stored. Instead, the products with
+ * the evaluation matrix are computed whenever data is mapped, by evaluating the basis functions in blocks of output
+ * vertices or input vertices, respectively, in parallel using the thread pool.
+ *
+ * With RBFSolver::ITERATIVE, the interpolation matrix is not decomposed. Instead, the interpolation system is solved
+ * by the conjugate gradient method for strictly positive definite basis functions and by BiCGSTAB otherwise, starting
+ * from the coefficients of the previous solve. For basis functions with compact support, the interpolation matrix is
+ * assembled as sparse matrix. The integrated polynomial is not supported.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctSolver {
@@ -30,26 +47,63 @@ public:
   /// Assembles the system matrices and computes the decomposition of the interpolation matrix
   template <typename IndexContainer>
   RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                       const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial);
+                       const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                       RBFEvaluation evaluation = RBFEvaluation::MATRIX, RBFSolver solver = RBFSolver::DIRECT, double solverRtol = 1e-9);
 
-  /// Maps the given input data
-  Eigen::VectorXd solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const;
+  /**
+   * @brief Maps the given input data
+   *
+   * @param[in] previousCoefficients Optional initial guess of the iterative solver, which is replaced by the new coefficients
+   */
+  Eigen::VectorXd solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial, Eigen::VectorXd *previousCoefficients = nullptr) const;
 
-  /// Maps the given input data
-  Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
+  /// Maps the given input data, see solveConsistent()
+  Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial, Eigen::VectorXd *previousCoefficients = nullptr) const;
 
   // Clear all stored matrices
   void clear();
 
-  // Access to the evaluation matrix (output x input)
-  const Eigen::MatrixXd &getEvaluationMatrix() const;
+  /// Returns the number of rows of the evaluation matrix, which is the number of output vertices
+  Eigen::Index getOutputSize() const;
+
+  /// Returns the number of columns of the evaluation matrix, which is the number of input vertices plus polynomial parameters
+  Eigen::Index getInputSize() const;
 
 private:
-  precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
+  mutable precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
+
+  /// Number of output vertices per block of the evaluation on the fly
+  static constexpr std::size_t OutputBlockSize = 256;
+
+  /// Number of input vertices per block of the transposed evaluation on the fly
+  static constexpr std::size_t InputBlockSize = 16;
+
+  /// Computes the product of the evaluation matrix with the coefficients
+  Eigen::VectorXd multiplyEvaluation(const Eigen::VectorXd &coefficients) const;
+
+  /// Computes the product of the transposed evaluation matrix with the data
+  Eigen::VectorXd multiplyEvaluationTransposed(const Eigen::VectorXd &data) const;
+
+  /// Solves the interpolation system, using the decomposition or the iterative solver
+  Eigen::VectorXd solveInterpolation(const Eigen::VectorXd &rhs, Eigen::VectorXd *previousCoefficients) const;
+
+  /// Solves the interpolation system with the given matrix iteratively
+  template <typename MatrixType>
+  Eigen::VectorXd solveIteratively(const MatrixType &matrix, const Eigen::VectorXd &rhs, Eigen::VectorXd *previousCoefficients) const;
 
   /// Decomposition of the interpolation matrix
   DecompositionType _decMatrixC;
 
+  /// Solver of the interpolation system
+  RBFSolver _solver = RBFSolver::DIRECT;
+
+  /// Relative tolerance of the iterative solver
+  double _solverRtol = 1e-9;
+
+  /// Interpolation matrix for the iterative solver, sparse for basis functions with compact support
+  Eigen::SparseMatrix<double> _sparseMatrixC;
+  Eigen::MatrixXd             _denseMatrixC;
+
   /// Decomposition of the polynomial (for separate polynomial)
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixQ;
 
@@ -59,8 +113,17 @@ private:
   /// Polynomial matrix of the output mesh (for separate polynomial)
   Eigen::MatrixXd _matrixV;
 
-  /// Evaluation matrix (output x input)
+  /// Evaluation matrix (output x input), empty for evaluation on the fly
   Eigen::MatrixXd _matrixA;
+
+  /// Basis function, coordinates, and integrated polynomial for evaluation on the fly
+  std::shared_ptr<const RADIAL_BASIS_FUNCTION_T> _basisFunction;
+  std::array<bool, 3>                            _activeAxis{};
+  std::vector<std::array<double, 3>>             _inputCoords;
+  std::vector<std::array<double, 3>>             _outputCoords;
+
+  /// Polynomial part of the evaluation matrix (for integrated polynomial evaluated on the fly)
+  Eigen::MatrixXd _outputPolynomial;
 };
 
 // ------- Non-Member Functions ---------
@@ -145,6 +208,59 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
   return matrixCLU;
 }
 
+/// Assembles the interpolation matrix of a basis function with compact support, finding the vertices within the support radius by a k-d tree
+template <int Dim, typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
+Eigen::SparseMatrix<double> buildSparseMatrixC(const RADIAL_BASIS_FUNCTION_T &basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                               std::array<bool, 3> activeAxis)
+{
+  PRECICE_ASSERT(inputMesh.getDimensions() == Dim, inputMesh.getDimensions());
+  const std::vector<VertexID> ids(inputIDs.begin(), inputIDs.end());
+  std::vector<Eigen::Index>   columns(inputMesh.vertices().size(), -1);
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    columns[ids[i]] = i;
+  }
+
+  const query::impl::KDTree<Dim> tree(inputMesh.vertices());
+  const double                   supportRadius = basisFunction.getSupportRadius();
+
+  // Each block of rows collects its own entries, which keeps the assembly deterministic
+  constexpr std::size_t                            grainSize = 256;
+  std::vector<std::vector<Eigen::Triplet<double>>> blocks((ids.size() + grainSize - 1) / grainSize);
+  utils::parallelFor(0, ids.size(), grainSize, [&](std::size_t begin, std::size_t end) {
+    auto &                        triplets = blocks[begin / grainSize];
+    std::vector<VertexID>         matches;
+    Eigen::Matrix<double, Dim, 1> min, max;
+    for (auto i = begin; i < end; ++i) {
+      const auto &u = inputMesh.vertices()[ids[i]].rawCoords();
+      for (int d = 0; d < Dim; ++d) {
+        const double extent = activeAxis[d] ? supportRadius : std::numeric_limits<double>::infinity();
+        min[d]              = u[d] - extent;
+        max[d]              = u[d] + extent;
+      }
+      matches.clear();
+      tree.insideBox(min, max, matches);
+      for (const VertexID id : matches) {
+        const Eigen::Index j = columns[id];
+        if (j < 0) {
+          continue;
+        }
+        const double value = basisFunction.evaluate(std::sqrt(computeSquaredDifference(u, inputMesh.vertices()[id].rawCoords(), activeAxis)));
+        if (value != 0.0) {
+          triplets.emplace_back(i, j, value);
+        }
+      }
+    }
+  });
+
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (const auto &block : blocks) {
+    triplets.insert(triplets.end(), block.begin(), block.end());
+  }
+  Eigen::SparseMatrix<double> matrixC(ids.size(), ids.size());
+  matrixC.setFromTriplets(triplets.begin(), triplets.end());
+  return matrixC;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
 Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
                              const mesh::Mesh &outputMesh, const IndexContainer outputIDs, std::array<bool, 3> activeAxis, Polynomial polynomial)
@@ -184,7 +300,8 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
 template <typename RADIAL_BASIS_FUNCTION_T>
 template <typename IndexContainer>
 RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                                                                    const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial)
+                                                                    const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                                                                    RBFEvaluation evaluation, RBFSolver solver, double solverRtol)
 {
   PRECICE_ASSERT(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
   // Convert dead axis vector into an active axis array so that we can handle the reduction more easily
@@ -193,7 +310,22 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
 
   // First, assemble the interpolation matrix and check the invertability
   bool decompositionSuccessful = false;
-  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+  if (solver == RBFSolver::ITERATIVE) {
+    PRECICE_ASSERT(polynomial != Polynomial::ON, "The iterative solver does not support the integrated polynomial.");
+    _solver                 = solver;
+    _solverRtol             = solverRtol;
+    decompositionSuccessful = true;
+    if (RADIAL_BASIS_FUNCTION_T::hasCompactSupport() && std::isfinite(basisFunction.getSupportRadius())) {
+      if (inputMesh.getDimensions() == 2) {
+        _sparseMatrixC = buildSparseMatrixC<2>(basisFunction, inputMesh, inputIDs, activeAxis);
+      } else {
+        _sparseMatrixC = buildSparseMatrixC<3>(basisFunction, inputMesh, inputIDs, activeAxis);
+      }
+      PRECICE_DEBUG("Assembled sparse interpolation matrix with {} non-zeros", _sparseMatrixC.nonZeros());
+    } else {
+      _denseMatrixC = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial);
+    }
+  } else if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
     _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
     decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
   } else {
@@ -208,8 +340,26 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
                 "by marking perpendicular axes as dead?",
                 inputMesh.getName(), outputMesh.getName());
 
-  // Second, assemble evaluation matrix
-  _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  // Second, assemble evaluation matrix or store what is needed to evaluate it on the fly
+  if (evaluation == RBFEvaluation::MATRIX) {
+    _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  } else {
+    _basisFunction = std::make_shared<const RADIAL_BASIS_FUNCTION_T>(basisFunction);
+    _activeAxis    = activeAxis;
+    _inputCoords.reserve(inputIDs.size());
+    for (const auto id : inputIDs) {
+      _inputCoords.push_back(inputMesh.vertices()[id].rawCoords());
+    }
+    _outputCoords.reserve(outputIDs.size());
+    for (const auto id : outputIDs) {
+      _outputCoords.push_back(outputMesh.vertices()[id].rawCoords());
+    }
+    if (polynomial == Polynomial::ON) {
+      const unsigned int polyParams = 4 - std::count(activeAxis.begin(), activeAxis.end(), false);
+      _outputPolynomial.resize(outputIDs.size(), polyParams);
+      fillPolynomialEntries(_outputPolynomial, outputMesh, outputIDs, 0, activeAxis);
+    }
+  }
 
   // In case we deal with separated polynomials, we need dedicated matrices for the polynomial contribution
   if (polynomial == Polynomial::SEPARATE) {
@@ -230,17 +380,17 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial, Eigen::VectorXd *previousCoefficients) const
 {
   PRECICE_ASSERT((_matrixV.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixV.size() == 0, _matrixV.size());
   // TODO: Avoid temporary allocations
   // Au is equal to the eta in our PETSc implementation
-  PRECICE_ASSERT(inputData.size() == _matrixA.rows());
-  Eigen::VectorXd Au = _matrixA.transpose() * inputData;
-  PRECICE_ASSERT(Au.size() == _matrixA.cols());
+  PRECICE_ASSERT(inputData.size() == getOutputSize());
+  Eigen::VectorXd Au = multiplyEvaluationTransposed(inputData);
+  PRECICE_ASSERT(Au.size() == getInputSize());
 
   // mu in the PETSc implementation
-  Eigen::VectorXd out = _decMatrixC.solve(Au);
+  Eigen::VectorXd out = solveInterpolation(Au, previousCoefficients);
 
   if (polynomial == Polynomial::SEPARATE) {
     Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
@@ -278,7 +428,7 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial, Eigen::VectorXd *previousCoefficients) const
 {
   PRECICE_ASSERT((_matrixQ.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixQ.size() == 0);
   Eigen::VectorXd polynomialContribution;
@@ -289,10 +439,10 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   }
 
   // Integrated polynomial (and separated)
-  PRECICE_ASSERT(inputData.size() == _matrixA.cols());
-  Eigen::VectorXd p = _decMatrixC.solve(inputData);
-  PRECICE_ASSERT(p.size() == _matrixA.cols());
-  Eigen::VectorXd out = _matrixA * p;
+  PRECICE_ASSERT(inputData.size() == getInputSize());
+  Eigen::VectorXd p = solveInterpolation(inputData, previousCoefficients);
+  PRECICE_ASSERT(p.size() == getInputSize());
+  Eigen::VectorXd out = multiplyEvaluation(p);
 
   // Add the polynomial part again for separated polynomial
   if (polynomial == Polynomial::SEPARATE) {
@@ -301,17 +451,124 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   return out;
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveInterpolation(const Eigen::VectorXd &rhs, Eigen::VectorXd *previousCoefficients) const
+{
+  if (_solver == RBFSolver::DIRECT) {
+    return _decMatrixC.solve(rhs);
+  }
+  if (_sparseMatrixC.size() > 0) {
+    return solveIteratively(_sparseMatrixC, rhs, previousCoefficients);
+  }
+  return solveIteratively(_denseMatrixC, rhs, previousCoefficients);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveIteratively(const MatrixType &matrix, const Eigen::VectorXd &rhs, Eigen::VectorXd *previousCoefficients) const
+{
+  precice::utils::Event e("map.rbf.solveIteratively");
+  // The diagonal of strictly positive definite basis functions is positive, others may vanish at zero
+  using Solver = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(),
+                                    Eigen::ConjugateGradient<MatrixType, Eigen::Lower | Eigen::Upper, Eigen::DiagonalPreconditioner<double>>,
+                                    Eigen::BiCGSTAB<MatrixType, Eigen::IdentityPreconditioner>>;
+  Solver solver;
+  solver.setTolerance(_solverRtol);
+  solver.compute(matrix);
+
+  Eigen::VectorXd coefficients;
+  if (previousCoefficients && previousCoefficients->size() == rhs.size()) {
+    coefficients = solver.solveWithGuess(rhs, *previousCoefficients);
+  } else {
+    coefficients = solver.solve(rhs);
+  }
+  PRECICE_CHECK(solver.info() == Eigen::Success,
+                "The iterative solver of the RBF mapping did not converge to the relative tolerance {} within {} iterations. "
+                "Please check if your coupling meshes are correct, increase the \"solver-rtol\", or use the direct solver.",
+                _solverRtol, solver.maxIterations());
+  PRECICE_DEBUG("The iterative solver converged in {} iterations to an estimated error of {}", solver.iterations(), solver.error());
+  if (previousCoefficients) {
+    *previousCoefficients = coefficients;
+  }
+  return coefficients;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
 {
-  _matrixA    = Eigen::MatrixXd();
-  _decMatrixC = DecompositionType();
+  _matrixA       = Eigen::MatrixXd();
+  _decMatrixC    = DecompositionType();
+  _sparseMatrixC = Eigen::SparseMatrix<double>();
+  _denseMatrixC  = Eigen::MatrixXd();
+  _basisFunction.reset();
+  _inputCoords.clear();
+  _outputCoords.clear();
+  _outputPolynomial = Eigen::MatrixXd();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
+{
+  return _basisFunction ? static_cast<Eigen::Index>(_outputCoords.size()) : _matrixA.rows();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
+{
+  return _basisFunction ? static_cast<Eigen::Index>(_inputCoords.size() + _outputPolynomial.cols()) : _matrixA.cols();
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-const Eigen::MatrixXd &RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getEvaluationMatrix() const
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::multiplyEvaluation(const Eigen::VectorXd &coefficients) const
 {
-  return _matrixA;
+  if (not _basisFunction) {
+    return _matrixA * coefficients;
+  }
+
+  precice::utils::Event e("map.rbf.evaluateOnTheFly");
+  const auto &    basisFunction = *_basisFunction;
+  const auto      inputSize     = _inputCoords.size();
+  Eigen::VectorXd out(_outputCoords.size());
+  utils::parallelFor(0, _outputCoords.size(), OutputBlockSize, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      double sum = 0.0;
+      for (std::size_t j = 0; j < inputSize; ++j) {
+        sum += basisFunction.evaluate(std::sqrt(computeSquaredDifference(_outputCoords[i], _inputCoords[j], _activeAxis))) * coefficients[j];
+      }
+      out[i] = sum;
+    }
+  });
+  if (_outputPolynomial.size() > 0) {
+    out += _outputPolynomial * coefficients.tail(_outputPolynomial.cols());
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::multiplyEvaluationTransposed(const Eigen::VectorXd &data) const
+{
+  if (not _basisFunction) {
+    return _matrixA.transpose() * data;
+  }
+
+  precice::utils::Event e("map.rbf.evaluateOnTheFly");
+  const auto &    basisFunction = *_basisFunction;
+  const auto      outputSize    = _outputCoords.size();
+  Eigen::VectorXd out(getInputSize());
+  // Blocks of input vertices are independent, such that no reduction among the threads is required
+  utils::parallelFor(0, _inputCoords.size(), InputBlockSize, [&](std::size_t begin, std::size_t end) {
+    Eigen::VectorXd sums = Eigen::VectorXd::Zero(end - begin);
+    for (std::size_t i = 0; i < outputSize; ++i) {
+      for (auto j = begin; j < end; ++j) {
+        sums[j - begin] += basisFunction.evaluate(std::sqrt(computeSquaredDifference(_outputCoords[i], _inputCoords[j], _activeAxis))) * data[i];
+      }
+    }
+    out.segment(begin, end - begin) = sums;
+  });
+  if (_outputPolynomial.size() > 0) {
+    out.tail(_outputPolynomial.cols()) = _outputPolynomial.transpose() * data;
+  }
+  return out;
 }
 
 } // namespace mapping
@@ -0,0 +1,111 @@
+#include "mapping/SparseOperator.hpp"
+#include <algorithm>
+#include "utils/ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::mapping {
+
+SparseOperator::SparseOperator()
+    : _rowOffsets{0}
+{
+}
+
+void SparseOperator::reserve(std::size_t rows, std::size_t nonZeros)
+{
+  _rowOffsets.reserve(rows + 1);
+  _columns.reserve(nonZeros);
+  _weights.reserve(nonZeros);
+}
+
+void SparseOperator::appendRow(const std::vector<WeightedElement> &entries)
+{
+  for (const auto &entry : entries) {
+    _columns.push_back(entry.vertexID);
+    _weights.push_back(entry.weight);
+  }
+  _rowOffsets.push_back(_columns.size());
+}
+
+void SparseOperator::appendRow(int column, double weight)
+{
+  _columns.push_back(column);
+  _weights.push_back(weight);
+  _rowOffsets.push_back(_columns.size());
+}
+
+void SparseOperator::clear()
+{
+  _rowOffsets.assign(1, 0);
+  _columns.clear();
+  _weights.clear();
+}
+
+std::size_t SparseOperator::rows() const
+{
+  return _rowOffsets.size() - 1;
+}
+
+std::size_t SparseOperator::nonZeros() const
+{
+  return _columns.size();
+}
+
+void SparseOperator::transpose(std::size_t rows)
+{
+  // Count the entries per column, which become the new rows
+  std::vector<std::size_t> offsets(rows + 1, 0);
+  for (int column : _columns) {
+    PRECICE_ASSERT(column >= 0 && static_cast<std::size_t>(column) < rows, column, rows);
+    ++offsets[column + 1];
+  }
+  for (std::size_t row = 0; row < rows; ++row) {
+    offsets[row + 1] += offsets[row];
+  }
+
+  // Traversing the old rows in order sorts the new rows by column
+  std::vector<int>    columns(_columns.size());
+  std::vector<double> weights(_weights.size());
+  auto                next = offsets;
+  forEachEntry([&](std::size_t row, int column, double weight) {
+    const auto k = next[column]++;
+    columns[k]   = static_cast<int>(row);
+    weights[k]   = weight;
+  });
+
+  _rowOffsets = std::move(offsets);
+  _columns    = std::move(columns);
+  _weights    = std::move(weights);
+}
+
+void SparseOperator::multiply(const Eigen::VectorXd &in, Eigen::VectorXd &out, int dimensions) const
+{
+  PRECICE_ASSERT(static_cast<std::size_t>(out.size()) == rows() * dimensions, out.size(), rows(), dimensions);
+
+  const double *inData  = in.data();
+  double *      outData = out.data();
+  utils::parallelFor(0, rows(), 1024, [&](std::size_t begin, std::size_t end) {
+    if (dimensions == 1) {
+      for (auto row = begin; row < end; ++row) {
+        double sum = 0.0;
+        for (auto k = _rowOffsets[row]; k < _rowOffsets[row + 1]; ++k) {
+          PRECICE_ASSERT(_columns[k] < in.size(), _columns[k], in.size());
+          sum += _weights[k] * inData[_columns[k]];
+        }
+        outData[row] += sum;
+      }
+      return;
+    }
+    for (auto row = begin; row < end; ++row) {
+      double *target = outData + row * dimensions;
+      for (auto k = _rowOffsets[row]; k < _rowOffsets[row + 1]; ++k) {
+        const double *source = inData + static_cast<std::size_t>(_columns[k]) * dimensions;
+        PRECICE_ASSERT((_columns[k] + 1) * dimensions <= in.size(), _columns[k], dimensions, in.size());
+        for (int dim = 0; dim < dimensions; ++dim) {
+          target[dim] += _weights[k] * source[dim];
+        }
+      }
+    }
+  });
+}
+
+} // namespace precice::mapping
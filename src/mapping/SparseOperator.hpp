@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+#include "mapping/Polation.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * @brief Linear operator between the vertex values of two meshes, stored in compressed sparse row (CSR) format.
+ *
+ * Row i holds the weights of the input vertices contributing to output vertex i.
+ * The columns and weights of all rows are stored contiguously, which avoids an allocation per vertex.
+ * Applying the operator processes the rows concurrently using the thread pool.
+ */
+class SparseOperator {
+public:
+  /// Creates an empty operator without rows
+  SparseOperator();
+
+  /// Reserves memory for the given number of rows and non-zero entries
+  void reserve(std::size_t rows, std::size_t nonZeros);
+
+  /// Appends a row with the given entries
+  void appendRow(const std::vector<WeightedElement> &entries);
+
+  /// Appends a row with a single entry
+  void appendRow(int column, double weight);
+
+  /// Removes all rows
+  void clear();
+
+  /// Returns the number of rows
+  std::size_t rows() const;
+
+  /// Returns the number of stored entries
+  std::size_t nonZeros() const;
+
+  /**
+   * @brief Transposes the operator, such that it has the given number of rows afterwards.
+   *
+   * Mappings computing the stencils per input vertex use this to map by output vertex.
+   * Within each row, the entries are sorted by column.
+   */
+  void transpose(std::size_t rows);
+
+  /**
+   * @brief Applies the operator to vertex values with the given number of components.
+   *
+   * Computes out += A * in for every component.
+   */
+  void multiply(const Eigen::VectorXd &in, Eigen::VectorXd &out, int dimensions) const;
+
+  /// Calls func(row, column, weight) for every stored entry
+  template <typename Func>
+  void forEachEntry(Func &&func) const
+  {
+    for (std::size_t row = 0; row < rows(); ++row) {
+      for (auto k = _rowOffsets[row]; k < _rowOffsets[row + 1]; ++k) {
+        func(row, _columns[k], _weights[k]);
+      }
+    }
+  }
+
+private:
+  /// Start of each row in _columns and _weights, followed by the number of entries
+  std::vector<std::size_t> _rowOffsets;
+
+  std::vector<int> _columns;
+
+  std::vector<double> _weights;
+};
+
+} // namespace mapping
+} // namespace precice
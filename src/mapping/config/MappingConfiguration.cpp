@@ -55,6 +55,20 @@ MappingConfiguration::MappingConfiguration(
                                .setOptions({"estimate", "compute", "off", "save", "tree"});
   auto attrUseLU = makeXMLAttribute(ATTR_USE_QR, false)
                        .setDocumentation("If set to true, QR decomposition is used to solve the RBF system");
+  auto attrEvaluation = makeXMLAttribute(ATTR_EVALUATION, VALUE_EVALUATION_MATRIX)
+                            .setDocumentation("Sets how the Eigen RBF implementation evaluates the interpolant at the output mesh. "
+                                              "\"matrix\" stores the dense evaluation matrix. "
+                                              "\"on-the-fly\" evaluates the basis functions in blocks of output vertices whenever data is mapped, "
+                                              "which trades recomputation for memory proportional to the size of the meshes.")
+                            .setOptions({VALUE_EVALUATION_MATRIX, VALUE_EVALUATION_ON_THE_FLY});
+  auto attrSolver = makeXMLAttribute(ATTR_SOLVER, VALUE_SOLVER_DIRECT)
+                        .setDocumentation("Sets how the Eigen RBF implementation solves the interpolation system. "
+                                          "\"direct\" decomposes the dense interpolation matrix. "
+                                          "\"iterative\" uses the conjugate gradient method for positive definite basis functions and BiCGSTAB otherwise, "
+                                          "up to the relative tolerance \"solver-rtol\", starting from the solution of the previous mapping. "
+                                          "For basis functions with compact support, the interpolation matrix is stored as sparse matrix. "
+                                          "Requires polynomial=\"separate\" or polynomial=\"off\".")
+                        .setOptions({VALUE_SOLVER_DIRECT, VALUE_SOLVER_ITERATIVE});
 
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag>  tags;
@@ -128,6 +142,8 @@ MappingConfiguration::MappingConfiguration(
     tag.addAttribute(attrYDead);
     tag.addAttribute(attrZDead);
     tag.addAttribute(attrUseLU);
+    tag.addAttribute(attrEvaluation);
+    tag.addAttribute(attrSolver);
   }
   {
     XMLTag tag(*this, VALUE_NEAREST_NEIGHBOR, occ, TAG);
@@ -199,6 +215,8 @@ void MappingConfiguration::xmlTagCallback(
     bool          useLU         = false;
     Polynomial    polynomial    = Polynomial::ON;
     Preallocation preallocation = Preallocation::TREE;
+    RBFEvaluation evaluation    = RBFEvaluation::MATRIX;
+    RBFSolver     solver        = RBFSolver::DIRECT;
 
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)) {
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -243,6 +261,20 @@ void MappingConfiguration::xmlTagCallback(
       else if (strPrealloc == "off")
         preallocation = Preallocation::OFF;
     }
+    if (tag.hasAttribute(ATTR_EVALUATION)) {
+      if (tag.getStringAttributeValue(ATTR_EVALUATION) == VALUE_EVALUATION_ON_THE_FLY) {
+        evaluation = RBFEvaluation::ON_THE_FLY;
+      }
+    }
+    if (tag.hasAttribute(ATTR_SOLVER)) {
+      if (tag.getStringAttributeValue(ATTR_SOLVER) == VALUE_SOLVER_ITERATIVE) {
+        solver = RBFSolver::ITERATIVE;
+      }
+    }
+    PRECICE_CHECK(solver == RBFSolver::DIRECT || polynomial != Polynomial::ON,
+                  "The iterative solver of the RBF mapping from mesh \"{}\" to mesh \"{}\" does not support the integrated polynomial. "
+                  "Please set polynomial=\"separate\" or polynomial=\"off\", or use solver=\"direct\".",
+                  fromMesh, toMesh);
 
     RBFParameter rbfParameter;
     // Check valid combinations for the Gaussian RBF input
@@ -264,7 +296,7 @@ void MappingConfiguration::xmlTagCallback(
                                                         rbfParameter, solverRtol,
                                                         xDead, yDead, zDead,
                                                         useLU,
-                                                        polynomial, preallocation);
+                                                        polynomial, preallocation, evaluation, solver);
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
   }
@@ -295,7 +327,9 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     bool                             zDead,
     bool                             useLU,
     Polynomial                       polynomial,
-    Preallocation                    preallocation) const
+    Preallocation                    preallocation,
+    RBFEvaluation                    evaluation,
+    RBFSolver                        solver) const
 {
   PRECICE_TRACE(direction, type, timing, rbfParameter.value);
   using namespace mapping;
@@ -389,20 +423,20 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     PRECICE_DEBUG("Eigen RBF is used");
     if (type == VALUE_RBF_TPS) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), {{xDead, yDead, zDead}}, polynomial));
+          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_MULTIQUADRICS) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::ShapeParameter)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Multiquadrics>(
-              constraintValue, dimensions, Multiquadrics(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, Multiquadrics(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::ShapeParameter)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<InverseMultiquadrics>(
-              constraintValue, dimensions, InverseMultiquadrics(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, InverseMultiquadrics(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_VOLUME_SPLINES) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), {{xDead, yDead, zDead}}, polynomial));
+          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_GAUSSIAN) {
       double shapeParameter = rbfParameter.value;
       if (rbfParameter.type == RBFParameter::Type::SupportRadius) {
@@ -411,32 +445,32 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
       }
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Gaussian>(
-              constraintValue, dimensions, Gaussian(shapeParameter), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, Gaussian(shapeParameter), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_CTPS_C2) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::SupportRadius)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactThinPlateSplinesC2>(
-              constraintValue, dimensions, CompactThinPlateSplinesC2(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, CompactThinPlateSplinesC2(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::SupportRadius)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC0>(
-              constraintValue, dimensions, CompactPolynomialC0(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, CompactPolynomialC0(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C2) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::SupportRadius)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC2>(
-              constraintValue, dimensions, CompactPolynomialC2(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, CompactPolynomialC2(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C4) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::SupportRadius)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC4>(
-              constraintValue, dimensions, CompactPolynomialC4(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, CompactPolynomialC4(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
       PRECICE_ASSERT(rbfParameter.type == RBFParameter::Type::SupportRadius)
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC6>(
-              constraintValue, dimensions, CompactPolynomialC6(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial));
+              constraintValue, dimensions, CompactPolynomialC6(rbfParameter.value), {{xDead, yDead, zDead}}, polynomial, evaluation, solver, solverRtol));
     } else {
       PRECICE_ERROR("Unknown mapping type!");
     }
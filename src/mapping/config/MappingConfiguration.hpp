@@ -30,6 +30,26 @@ enum class Preallocation {
   TREE
 };
 
+/// How to evaluate the interpolant at the output vertices?
+/**
+ * MATRIX: Assemble and store the evaluation matrix
+ * ON_THE_FLY: Evaluate the basis functions in blocks of output vertices, whenever data is mapped
+ */
+enum class RBFEvaluation {
+  MATRIX,
+  ON_THE_FLY
+};
+
+/// How to solve the interpolation system?
+/**
+ * DIRECT: Decompose the dense interpolation matrix
+ * ITERATIVE: Solve with a Krylov method, starting from the previous solution
+ */
+enum class RBFSolver {
+  DIRECT,
+  ITERATIVE
+};
+
 enum class RBFType {
   EIGEN,
   PETSc
@@ -125,6 +145,8 @@ private:
   const std::string ATTR_Y_DEAD         = "y-dead";
   const std::string ATTR_Z_DEAD         = "z-dead";
   const std::string ATTR_USE_QR         = "use-qr-decomposition";
+  const std::string ATTR_EVALUATION     = "evaluation";
+  const std::string ATTR_SOLVER         = "solver";
 
   const std::string VALUE_WRITE             = "write";
   const std::string VALUE_READ              = "read";
@@ -149,6 +171,12 @@ private:
 
   const std::string VALUE_NEAREST_NEIGHBOR_GRADIENT = "nearest-neighbor-gradient";
 
+  const std::string VALUE_EVALUATION_MATRIX     = "matrix";
+  const std::string VALUE_EVALUATION_ON_THE_FLY = "on-the-fly";
+
+  const std::string VALUE_SOLVER_DIRECT    = "direct";
+  const std::string VALUE_SOLVER_ITERATIVE = "iterative";
+
   const std::string VALUE_TIMING_INITIAL    = "initial";
   const std::string VALUE_TIMING_ON_ADVANCE = "onadvance";
   const std::string VALUE_TIMING_ON_DEMAND  = "ondemand";
@@ -172,7 +200,9 @@ private:
       bool                             zDead,
       bool                             useLU,
       Polynomial                       polynomial,
-      Preallocation                    preallocation) const;
+      Preallocation                    preallocation,
+      RBFEvaluation                    evaluation,
+      RBFSolver                        solver) const;
 
   /// Check whether a mapping to and from the same mesh already exists
   void checkDuplicates(const ConfiguredMapping &mapping);
@@ -68,6 +68,7 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental)
   // Map data with almost coinciding vertices, has to result in equal values.
   inVertex0.setCoords(outVertex0.getCoords() + Eigen::Vector2d::Constant(0.1));
   inVertex1.setCoords(outVertex1.getCoords() + Eigen::Vector2d::Constant(0.1));
+  mapping.clear();
   mapping.computeMapping();
   mapping.map(inDataScalarID, outDataScalarID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -79,6 +80,7 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental)
   // Map data with exchanged vertices, has to result in exchanged values.
   inVertex0.setCoords(outVertex1.getCoords());
   inVertex1.setCoords(outVertex0.getCoords());
+  mapping.clear();
   mapping.computeMapping();
   mapping.map(inDataScalarID, outDataScalarID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -90,6 +92,7 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental)
 
   // Map data with coinciding output vertices, has to result in same values.
   outVertex1.setCoords(outVertex0.getCoords());
+  mapping.clear();
   mapping.computeMapping();
   mapping.map(inDataScalarID, outDataScalarID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -141,6 +144,7 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   // Map data with almost coinciding vertices, has to result in equal values.
   inVertex0.setCoords(outVertex0.getCoords() + Eigen::Vector2d::Constant(0.1));
   inVertex1.setCoords(outVertex1.getCoords() + Eigen::Vector2d::Constant(0.1));
+  mapping.clear();
   mapping.computeMapping();
   mapping.map(inDataID, outDataID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -151,6 +155,7 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   // Map data with exchanged vertices, has to result in exchanged values.
   inVertex0.setCoords(outVertex1.getCoords());
   inVertex1.setCoords(outVertex0.getCoords());
+  mapping.clear();
   mapping.computeMapping();
   mapping.map(inDataID, outDataID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -160,6 +165,7 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
 
   // Map data with coinciding output vertices, has to result in double values.
   outVertex1.setCoords(Eigen::Vector2d::Constant(-1.0));
+  mapping.clear();
   mapping.computeMapping();
   mapping.map(inDataID, outDataID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -235,5 +241,53 @@ BOOST_AUTO_TEST_CASE(ScaledConsistentNonIncremental)
   BOOST_TEST(inValues(3) * scaleFactor == outValues(3));
 }
 
+BOOST_AUTO_TEST_CASE(UpdateMappingAfterMovingVertices)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 2;
+
+  // Create mesh to map from
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  PtrData inData   = inMesh->createData("InData", 1, 0_dataID);
+  int     inDataID = inData->getID();
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(2.0, 0.0));
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 2.0, 3.0;
+
+  // Create mesh to map to
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  PtrData outData   = outMesh->createData("OutData", 1, 1_dataID);
+  int     outDataID = outData->getID();
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(1.1, 0.0));
+  outMesh->allocateDataValues();
+
+  precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(outData->values()(0) == 1.0);
+  BOOST_TEST(outData->values()(1) == 2.0);
+
+  // Moving output vertices only updates their matches
+  outMesh->moveVertex(0, Eigen::Vector2d(1.9, 0.0));
+  mapping.updateMapping(*outMesh, {0});
+  BOOST_TEST(mapping.hasComputedMapping());
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(outData->values()(0) == 3.0);
+  BOOST_TEST(outData->values()(1) == 2.0);
+
+  // Moving input vertices updates all matches
+  inMesh->moveVertex(2, Eigen::Vector2d(5.0, 0.0));
+  inMesh->moveVertex(0, Eigen::Vector2d(1.8, 0.0));
+  mapping.updateMapping(*inMesh, {0, 2});
+  BOOST_TEST(mapping.hasComputedMapping());
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(outData->values()(0) == 1.0);
+  BOOST_TEST(outData->values()(1) == 2.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
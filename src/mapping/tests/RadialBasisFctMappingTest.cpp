@@ -16,6 +16,7 @@
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -1894,6 +1895,71 @@ BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
 }
 #undef doLocalCode
 
+#define doLocalCode(Type, function, polynomial)                                                                                                                \
+  {                                                                                                                                                            \
+    const auto                  evaluation = RBFEvaluation::ON_THE_FLY;                                                                                        \
+    RadialBasisFctMapping<Type> consistentMap2D(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial, evaluation);                             \
+    perform2DTestConsistentMapping(consistentMap2D);                                                                                                           \
+    RadialBasisFctMapping<Type> consistentMap2DVector(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial, evaluation);                       \
+    perform2DTestConsistentMappingVector(consistentMap2DVector);                                                                                               \
+    RadialBasisFctMapping<Type> consistentMap3D(Mapping::CONSISTENT, 3, function, {{false, false, false}}, polynomial, evaluation);                             \
+    perform3DTestConsistentMapping(consistentMap3D);                                                                                                           \
+    RadialBasisFctMapping<Type> conservativeMap2D(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial, evaluation);                         \
+    perform2DTestConservativeMapping(conservativeMap2D);                                                                                                       \
+    RadialBasisFctMapping<Type> conservativeMap2DVector(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial, evaluation);                   \
+    perform2DTestConservativeMappingVector(conservativeMap2DVector);                                                                                           \
+    RadialBasisFctMapping<Type> conservativeMap3D(Mapping::CONSERVATIVE, 3, function, {{false, false, false}}, polynomial, evaluation);                         \
+    perform3DTestConservativeMapping(conservativeMap3D);                                                                                                       \
+  }
+
+BOOST_AUTO_TEST_CASE(MapOnTheFly)
+{
+  PRECICE_TEST(1_rank);
+  // Evaluates the blocks by multiple threads
+  utils::ThreadPool::instance().configure(3, false);
+  ThinPlateSplines tps;
+  doLocalCode(ThinPlateSplines, tps, Polynomial::ON);
+  doLocalCode(ThinPlateSplines, tps, Polynomial::SEPARATE);
+  CompactPolynomialC2 c2(1.2);
+  doLocalCode(CompactPolynomialC2, c2, Polynomial::SEPARATE);
+  utils::ThreadPool::instance().configure(1, false);
+}
+#undef doLocalCode
+
+#define doLocalCode(Type, function, polynomial)                                                                                                                \
+  {                                                                                                                                                            \
+    const auto                  evaluation = RBFEvaluation::MATRIX;                                                                                            \
+    const auto                  solver     = RBFSolver::ITERATIVE;                                                                                             \
+    RadialBasisFctMapping<Type> consistentMap2D(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial, evaluation, solver, 1e-12);             \
+    perform2DTestConsistentMapping(consistentMap2D);                                                                                                           \
+    RadialBasisFctMapping<Type> consistentMap2DVector(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial, evaluation, solver, 1e-12);       \
+    perform2DTestConsistentMappingVector(consistentMap2DVector);                                                                                               \
+    RadialBasisFctMapping<Type> consistentMap3D(Mapping::CONSISTENT, 3, function, {{false, false, false}}, polynomial, evaluation, solver, 1e-12);             \
+    perform3DTestConsistentMapping(consistentMap3D);                                                                                                           \
+    RadialBasisFctMapping<Type> conservativeMap2D(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial, evaluation, solver, 1e-12);         \
+    perform2DTestConservativeMapping(conservativeMap2D);                                                                                                       \
+    RadialBasisFctMapping<Type> conservativeMap2DVector(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial, evaluation, solver, 1e-12);   \
+    perform2DTestConservativeMappingVector(conservativeMap2DVector);                                                                                           \
+    RadialBasisFctMapping<Type> conservativeMap3D(Mapping::CONSERVATIVE, 3, function, {{false, false, false}}, polynomial, evaluation, solver, 1e-12);         \
+    perform3DTestConservativeMapping(conservativeMap3D);                                                                                                       \
+  }
+
+BOOST_AUTO_TEST_CASE(MapIterative)
+{
+  PRECICE_TEST(1_rank);
+  // Assembles the sparse matrix by multiple threads
+  utils::ThreadPool::instance().configure(3, false);
+  CompactPolynomialC2 c2(1.2);
+  doLocalCode(CompactPolynomialC2, c2, Polynomial::SEPARATE);
+  doLocalCode(CompactPolynomialC2, c2, Polynomial::OFF);
+  utils::ThreadPool::instance().configure(1, false);
+  Gaussian gaussian(1.0);
+  doLocalCode(Gaussian, gaussian, Polynomial::SEPARATE);
+  ThinPlateSplines tps;
+  doLocalCode(ThinPlateSplines, tps, Polynomial::SEPARATE);
+}
+#undef doLocalCode
+
 void testDeadAxis2d(Polynomial polynomial, Mapping::Constraint constraint)
 {
   using Eigen::Vector2d;
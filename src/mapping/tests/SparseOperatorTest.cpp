@@ -0,0 +1,72 @@
+#include <Eigen/Core>
+#include <vector>
+#include "mapping/Polation.hpp"
+#include "mapping/SparseOperator.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(SparseOperatorTests)
+
+BOOST_AUTO_TEST_CASE(Multiply)
+{
+  PRECICE_TEST(1_rank);
+  SparseOperator op;
+  op.appendRow({{0, 0.5}, {2, 0.5}});
+  op.appendRow(1, 1.0);
+  op.appendRow(std::vector<WeightedElement>{});
+  BOOST_TEST(op.rows() == 3);
+  BOOST_TEST(op.nonZeros() == 3);
+
+  Eigen::VectorXd in(3);
+  in << 1.0, 2.0, 3.0;
+  Eigen::VectorXd out = Eigen::VectorXd::Constant(3, 1.0);
+  op.multiply(in, out, 1);
+  BOOST_TEST(testing::equals(out, Eigen::Vector3d(3.0, 3.0, 1.0)));
+
+  Eigen::VectorXd inVector(6);
+  inVector << 1.0, 10.0, 2.0, 20.0, 3.0, 30.0;
+  Eigen::VectorXd outVector = Eigen::VectorXd::Zero(6);
+  op.multiply(inVector, outVector, 2);
+  Eigen::VectorXd expected(6);
+  expected << 2.0, 20.0, 2.0, 20.0, 0.0, 0.0;
+  BOOST_TEST(testing::equals(outVector, expected));
+}
+
+BOOST_AUTO_TEST_CASE(Transpose)
+{
+  PRECICE_TEST(1_rank);
+  SparseOperator op;
+  op.appendRow({{2, 0.25}, {0, 0.75}});
+  op.appendRow(2, 1.0);
+  op.transpose(4);
+  BOOST_TEST(op.rows() == 4);
+  BOOST_TEST(op.nonZeros() == 3);
+
+  std::vector<int>    rows, columns;
+  std::vector<double> weights;
+  op.forEachEntry([&](std::size_t row, int column, double weight) {
+    rows.push_back(row);
+    columns.push_back(column);
+    weights.push_back(weight);
+  });
+  BOOST_TEST(rows == std::vector<int>({0, 2, 2}), boost::test_tools::per_element());
+  BOOST_TEST(columns == std::vector<int>({0, 0, 1}), boost::test_tools::per_element());
+  BOOST_TEST(weights == std::vector<double>({0.75, 0.25, 1.0}), boost::test_tools::per_element());
+
+  // Distributes the values of the former rows
+  Eigen::Vector2d in(4.0, 8.0);
+  Eigen::VectorXd out = Eigen::VectorXd::Zero(4);
+  op.multiply(in, out, 1);
+  BOOST_TEST(testing::equals(out, Eigen::Vector4d(3.0, 0.0, 9.0, 0.0)));
+
+  op.clear();
+  BOOST_TEST(op.rows() == 0);
+  BOOST_TEST(op.nonZeros() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SparseOperatorTests
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -86,15 +86,31 @@ Vertex &Mesh::createVertex(const Eigen::VectorXd &coords)
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
   _vertices.emplace_back(coords, nextID);
+  _index.insertVertex(nextID);
+  invalidateGeometry();
   return _vertices.back();
 }
 
+void Mesh::moveVertex(VertexID id, const Eigen::VectorXd &coords)
+{
+  PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
+  PRECICE_ASSERT(id >= 0 && static_cast<size_t>(id) < _vertices.size(), id, _vertices.size());
+  _index.removeVertex(id);
+  _vertices[id].setCoords(coords);
+  _index.insertVertex(id);
+  invalidateGeometry();
+  if (!_boundingBox.empty()) {
+    _boundingBox.expandBy(_vertices[id]);
+  }
+}
+
 Edge &Mesh::createEdge(
     Vertex &vertexOne,
     Vertex &vertexTwo)
 {
   auto nextID = _edges.size();
   _edges.emplace_back(vertexOne, vertexTwo, nextID);
+  invalidateGeometry();
   return _edges.back();
 }
 
@@ -127,6 +143,7 @@ Triangle &Mesh::createTriangle(
       edgeThree.connectedTo(edgeOne));
   auto nextID = _triangles.size();
   _triangles.emplace_back(edgeOne, edgeTwo, edgeThree, nextID);
+  invalidateGeometry();
   return _triangles.back();
 }
 
@@ -137,6 +154,7 @@ Triangle &Mesh::createTriangle(
 {
   auto nextID = _triangles.size();
   _triangles.emplace_back(vertexOne, vertexTwo, vertexThree, nextID);
+  invalidateGeometry();
   return _triangles.back();
 }
 
@@ -149,6 +167,7 @@ Tetrahedron &Mesh::createTetrahedron(
 
   auto nextID = _tetrahedra.size();
   _tetrahedra.emplace_back(vertexOne, vertexTwo, vertexThree, vertexFour, nextID);
+  invalidateGeometry();
   return _tetrahedra.back();
 }
 
@@ -293,6 +312,7 @@ void Mesh::clear()
   _vertices.clear();
   _tetrahedra.clear();
   _index.clear();
+  invalidateGeometry();
 
   for (mesh::PtrData &data : _data) {
     data->values().resize(0);
@@ -402,6 +422,89 @@ void Mesh::expandBoundingBox(const BoundingBox &boundingBox)
   _boundingBox.expandBy(boundingBox);
 }
 
+const Eigen::VectorXd &Mesh::getVertexAreas() const
+{
+  if (_geometry.hasVertexAreas) {
+    return _geometry.vertexAreas;
+  }
+  PRECICE_TRACE(_name);
+  Eigen::VectorXd &areas = _geometry.vertexAreas;
+  areas                  = Eigen::VectorXd::Zero(_vertices.size());
+  if (_dimensions == 2) {
+    for (const Edge &edge : _edges) {
+      const double half = 0.5 * edge.getLength();
+      areas[edge.vertex(0).getID()] += half;
+      areas[edge.vertex(1).getID()] += half;
+    }
+  } else {
+    for (const Triangle &triangle : _triangles) {
+      const double third = triangle.getArea() / 3.0;
+      for (int i = 0; i < 3; ++i) {
+        areas[triangle.vertex(i).getID()] += third;
+      }
+    }
+  }
+  _geometry.area           = areas.sum();
+  _geometry.hasVertexAreas = true;
+  return areas;
+}
+
+const Eigen::VectorXd &Mesh::getVertexVolumes() const
+{
+  if (_geometry.hasVertexVolumes) {
+    return _geometry.vertexVolumes;
+  }
+  PRECICE_TRACE(_name);
+  Eigen::VectorXd &volumes = _geometry.vertexVolumes;
+  volumes                  = Eigen::VectorXd::Zero(_vertices.size());
+  if (_dimensions == 2) {
+    for (const Triangle &triangle : _triangles) {
+      const double third = triangle.getArea() / 3.0;
+      for (int i = 0; i < 3; ++i) {
+        volumes[triangle.vertex(i).getID()] += third;
+      }
+    }
+  } else {
+    for (const Tetrahedron &tetra : _tetrahedra) {
+      const double quarter = tetra.getVolume() / 4.0;
+      for (int i = 0; i < 4; ++i) {
+        volumes[tetra.vertex(i).getID()] += quarter;
+      }
+    }
+  }
+  _geometry.hasVertexVolumes = true;
+  return volumes;
+}
+
+const Eigen::MatrixXd &Mesh::getTriangleNormals() const
+{
+  if (_geometry.hasTriangleNormals) {
+    return _geometry.triangleNormals;
+  }
+  PRECICE_TRACE(_name);
+  PRECICE_ASSERT(_dimensions == 3, _dimensions);
+  Eigen::MatrixXd &normals = _geometry.triangleNormals;
+  normals.resize(_dimensions, _triangles.size());
+  for (const Triangle &triangle : _triangles) {
+    normals.col(triangle.getID()) = triangle.computeNormal();
+  }
+  _geometry.hasTriangleNormals = true;
+  return normals;
+}
+
+double Mesh::getArea() const
+{
+  getVertexAreas();
+  return _geometry.area;
+}
+
+void Mesh::invalidateGeometry()
+{
+  _geometry.hasVertexAreas     = false;
+  _geometry.hasVertexVolumes   = false;
+  _geometry.hasTriangleNormals = false;
+}
+
 bool Mesh::operator==(const Mesh &other) const
 {
   bool equal = true;
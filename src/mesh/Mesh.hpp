@@ -117,6 +117,16 @@ public:
   /// Creates and initializes a Vertex object.
   Vertex &createVertex(const Eigen::VectorXd &coords);
 
+  /**
+   * @brief Moves an existing vertex to new coordinates.
+   *
+   * Updates the index of the mesh incrementally and expands the bounding box if required.
+   *
+   * @param[in] id ID of the vertex to move.
+   * @param[in] coords New coordinates of the vertex.
+   */
+  void moveVertex(VertexID id, const Eigen::VectorXd &coords);
+
   /**
    * @brief Creates and initializes an Edge object.
    *
@@ -293,6 +303,45 @@ public:
 
   void expandBoundingBox(const BoundingBox &bounding_box);
 
+  /**
+   * @brief Returns the lumped area of each vertex.
+   *
+   * In 2D, every vertex gets half of the length of each adjacent edge.
+   * In 3D, every vertex gets a third of the area of each adjacent triangle.
+   * Vertices without connectivity have zero area.
+   *
+   * The areas are computed on first use and cached until the mesh changes.
+   */
+  const Eigen::VectorXd &getVertexAreas() const;
+
+  /**
+   * @brief Returns the lumped volume of each vertex.
+   *
+   * In 2D, every vertex gets a third of the area of each adjacent triangle.
+   * In 3D, every vertex gets a quarter of the volume of each adjacent tetrahedron.
+   *
+   * The volumes are computed on first use and cached until the mesh changes.
+   */
+  const Eigen::VectorXd &getVertexVolumes() const;
+
+  /**
+   * @brief Returns the unit normals of all triangles of a 3D mesh, one per column.
+   *
+   * The normals are computed on first use and cached until the mesh changes.
+   */
+  const Eigen::MatrixXd &getTriangleNormals() const;
+
+  /// Returns the area of the local mesh, which is the sum of the vertex areas.
+  double getArea() const;
+
+  /**
+   * @brief Invalidates the cached geometric quantities.
+   *
+   * All member functions modifying the mesh call this.
+   * Call this after modifying vertices or elements through the containers directly.
+   */
+  void invalidateGeometry();
+
   bool operator==(const Mesh &other) const;
 
   bool operator!=(const Mesh &other) const;
@@ -364,6 +413,19 @@ private:
   BoundingBox _boundingBox;
 
   query::Index _index;
+
+  /// Lazily computed geometric quantities, see invalidateGeometry()
+  struct GeometryCache {
+    bool            hasVertexAreas     = false;
+    bool            hasVertexVolumes   = false;
+    bool            hasTriangleNormals = false;
+    Eigen::VectorXd vertexAreas;
+    Eigen::VectorXd vertexVolumes;
+    Eigen::MatrixXd triangleNormals;
+    double          area = 0.0;
+  };
+
+  mutable GeometryCache _geometry;
 };
 
 std::ostream &operator<<(std::ostream &os, const Mesh &q);
@@ -78,8 +78,8 @@ double Triangle::getArea() const
 
 Eigen::VectorXd Triangle::computeNormal() const
 {
-  Eigen::Vector3d vectorA = (vertex(1).getCoords() - vertex(0).getCoords()) / 2.0;
-  Eigen::Vector3d vectorB = (vertex(1).getCoords() - vertex(0).getCoords()) / 2.0;
+  Eigen::Vector3d vectorA = vertex(1).getCoords() - vertex(0).getCoords();
+  Eigen::Vector3d vectorB = vertex(2).getCoords() - vertex(0).getCoords();
 
   // Compute cross-product of vector A and vector B
   return vectorA.cross(vectorB).normalized();
@@ -1,68 +1,33 @@
 #include <Eigen/Core>
 #include <mesh/Edge.hpp>
 #include <mesh/Mesh.hpp>
+#include <utils/assertion.hpp>
 #include <utils/IntraComm.hpp>
 
 namespace precice::mesh {
 
-/// Given the data and the mesh, this function returns the surface integral. Assumes no overlap exists for the mesh
-Eigen::VectorXd integrate(const PtrMesh &mesh, const PtrData &data)
+namespace {
+
+/// Integrates the data using the given lumped measure per vertex
+Eigen::VectorXd integrateLumped(const Eigen::VectorXd &measures, const PtrData &data)
 {
-  const int       valueDimensions = data->getDimensions();
-  const int       meshDimensions  = mesh->getDimensions();
-  const auto &    values          = data->values();
-  Eigen::VectorXd integral        = Eigen::VectorXd::Zero(valueDimensions);
+  const int valueDimensions = data->getDimensions();
+  PRECICE_ASSERT(data->values().size() == measures.size() * valueDimensions, data->values().size(), measures.size());
+  Eigen::Map<const Eigen::MatrixXd> values(data->values().data(), valueDimensions, measures.size());
+  return values * measures;
+}
 
-  if (meshDimensions == 2) {
-    for (const auto &edge : mesh->edges()) {
-      int vertex1 = edge.vertex(0).getID() * valueDimensions;
-      int vertex2 = edge.vertex(1).getID() * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; ++dim) {
-        integral(dim) += 0.5 * edge.getLength() * (values(vertex1 + dim) + values(vertex2 + dim));
-      }
-    }
-  } else {
-    for (const auto &face : mesh->triangles()) {
-      int vertex1 = face.vertex(0).getID() * valueDimensions;
-      int vertex2 = face.vertex(1).getID() * valueDimensions;
-      int vertex3 = face.vertex(2).getID() * valueDimensions;
+} // namespace
 
-      for (int dim = 0; dim < valueDimensions; ++dim) {
-        integral(dim) += (face.getArea() / 3.0) * (values(vertex1 + dim) + values(vertex2 + dim) + values(vertex3 + dim));
-      }
-    }
-  }
-  return integral;
+/// Given the data and the mesh, this function returns the surface integral. Assumes no overlap exists for the mesh
+Eigen::VectorXd integrate(const PtrMesh &mesh, const PtrData &data)
+{
+  return integrateLumped(mesh->getVertexAreas(), data);
 }
 
 Eigen::VectorXd integrateVolume(const PtrMesh &mesh, const PtrData &data)
 {
-  const int       valueDimensions = data->getDimensions();
-  const int       meshDimensions  = mesh->getDimensions();
-  const auto &    values          = data->values();
-  Eigen::VectorXd integral        = Eigen::VectorXd::Zero(valueDimensions);
-  if (meshDimensions == 2) {
-    for (const auto &face : mesh->triangles()) {
-      int vertex1 = face.vertex(0).getID() * valueDimensions;
-      int vertex2 = face.vertex(1).getID() * valueDimensions;
-      int vertex3 = face.vertex(2).getID() * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; ++dim) {
-        integral(dim) += (face.getArea() / 3.0) * (values(vertex1 + dim) + values(vertex2 + dim) + values(vertex3 + dim));
-      }
-    }
-  } else {
-    for (const auto &tetra : mesh->tetrahedra()) {
-      int vertex1 = tetra.vertex(0).getID() * valueDimensions;
-      int vertex2 = tetra.vertex(1).getID() * valueDimensions;
-      int vertex3 = tetra.vertex(2).getID() * valueDimensions;
-      int vertex4 = tetra.vertex(3).getID() * valueDimensions;
-
-      for (int dim = 0; dim < valueDimensions; ++dim) {
-        integral(dim) += (tetra.getVolume() / 4.0) * (values(vertex1 + dim) + values(vertex2 + dim) + values(vertex3 + dim) + values(vertex4 + dim));
-      }
-    }
-  }
-  return integral;
+  return integrateLumped(mesh->getVertexVolumes(), data);
 }
 
 } // namespace precice::mesh
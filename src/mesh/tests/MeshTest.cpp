@@ -344,6 +344,38 @@ BOOST_AUTO_TEST_CASE(ResizeDataShrink)
   BOOST_TEST(values.size() == 2);
 }
 
+BOOST_AUTO_TEST_CASE(GeometryCache)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("MyMesh", 3, testing::nextMeshID());
+  auto &v0 = mesh.createVertex(Vector3d(0.0, 0.0, 0.0));
+  auto &v1 = mesh.createVertex(Vector3d(1.0, 0.0, 0.0));
+  auto &v2 = mesh.createVertex(Vector3d(0.0, 1.0, 0.0));
+  auto &v3 = mesh.createVertex(Vector3d(0.0, 0.0, 1.0));
+  mesh.createTriangle(v0, v1, v2);
+  mesh.createTetrahedron(v0, v1, v2, v3);
+
+  BOOST_TEST(equals(mesh.getVertexAreas(), Eigen::Vector4d(0.5 / 3, 0.5 / 3, 0.5 / 3, 0.0)));
+  BOOST_TEST(mesh.getArea() == 0.5);
+  BOOST_TEST(equals(mesh.getVertexVolumes(), Eigen::Vector4d::Constant(1.0 / 24)));
+  BOOST_TEST(mesh.getTriangleNormals().cols() == 1);
+  BOOST_TEST(equals(mesh.getTriangleNormals().col(0), Vector3d(0.0, 0.0, 1.0)));
+
+  // Moving a vertex invalidates the cached quantities
+  mesh.moveVertex(v1.getID(), Vector3d(2.0, 0.0, 0.0));
+  BOOST_TEST(mesh.getArea() == 1.0);
+  BOOST_TEST(equals(mesh.getVertexVolumes(), Eigen::Vector4d::Constant(1.0 / 12)));
+
+  // Adding elements invalidates the cached quantities
+  mesh.createTriangle(v0, v1, v3);
+  BOOST_TEST(mesh.getArea() == 2.0);
+  BOOST_TEST(equals(mesh.getTriangleNormals().col(1), Vector3d(0.0, -1.0, 0.0)));
+
+  mesh.clear();
+  BOOST_TEST(mesh.getVertexAreas().size() == 0);
+  BOOST_TEST(mesh.getArea() == 0.0);
+}
+
 BOOST_AUTO_TEST_SUITE(Utils)
 
 BOOST_AUTO_TEST_CASE(AsChain)
@@ -60,6 +60,12 @@ public:
     _m2ns.push_back(m2n);
   }
 
+  /// Returns true if the mesh is communicated to or from another participant.
+  bool isCommunicated() const
+  {
+    return not _m2ns.empty();
+  }
+
 protected:
   mesh::PtrMesh _mesh;
 
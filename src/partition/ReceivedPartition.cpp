@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -525,376 +526,310 @@ void ReceivedPartition::prepareBoundingBox()
   }
 }
 
+namespace {
+/// Sends a message to each neighbor rank and receives the message of each neighbor rank directly.
+std::map<Rank, std::vector<int>> exchangeDirectly(const std::map<Rank, std::vector<int>> &outgoing)
+{
+  auto &intraComm = *utils::IntraComm::getCommunication();
+
+  // the send buffers of the message sizes need to outlive the requests
+  std::map<Rank, int>          sendSizes;
+  std::vector<com::PtrRequest> requests;
+  for (const auto &message : outgoing) {
+    int &sendSize = sendSizes[message.first];
+    sendSize      = message.second.size();
+    requests.push_back(intraComm.aSend(sendSize, message.first));
+    if (sendSize != 0) {
+      requests.push_back(intraComm.aSend(span<const int>{message.second}, message.first));
+    }
+  }
+
+  // the neighbor relation is symmetric
+  std::map<Rank, std::vector<int>> incoming;
+  for (const auto &message : outgoing) {
+    int receiveSize = 0;
+    intraComm.receive(receiveSize, message.first);
+    std::vector<int> received(receiveSize, -1);
+    if (receiveSize != 0) {
+      intraComm.receive(span<int>{received}, message.first);
+    }
+    incoming.emplace(message.first, std::move(received));
+  }
+
+  for (auto &request : requests) {
+    request->wait();
+  }
+  return incoming;
+}
+
+/// Sends a message to each neighbor rank and receives the message of each neighbor rank, relayed by the primary rank.
+std::map<Rank, std::vector<int>> exchangeViaPrimary(const std::map<Rank, std::vector<int>> &outgoing)
+{
+  auto &intraComm = *utils::IntraComm::getCommunication();
+
+  std::map<Rank, std::vector<int>> incoming;
+  if (utils::IntraComm::isSecondary()) {
+    intraComm.send(static_cast<int>(outgoing.size()), 0);
+    for (const auto &message : outgoing) {
+      intraComm.send(message.first, 0);
+      intraComm.sendRange(message.second, 0);
+    }
+    int numberOfMessages = 0;
+    intraComm.receive(numberOfMessages, 0);
+    for (int i = 0; i < numberOfMessages; ++i) {
+      Rank source = -1;
+      intraComm.receive(source, 0);
+      incoming.emplace(source, intraComm.receiveRange(0, com::AsVectorTag<int>{}));
+    }
+    return incoming;
+  }
+
+  // destination -> source -> message
+  std::map<Rank, std::map<Rank, std::vector<int>>> mailbox;
+  for (const auto &message : outgoing) {
+    mailbox[message.first].emplace(0, message.second);
+  }
+  for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
+    int numberOfMessages = 0;
+    intraComm.receive(numberOfMessages, secondaryRank);
+    for (int i = 0; i < numberOfMessages; ++i) {
+      Rank destination = -1;
+      intraComm.receive(destination, secondaryRank);
+      mailbox[destination].emplace(secondaryRank, intraComm.receiveRange(secondaryRank, com::AsVectorTag<int>{}));
+    }
+  }
+  for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
+    const auto &messages = mailbox[secondaryRank];
+    intraComm.send(static_cast<int>(messages.size()), secondaryRank);
+    for (const auto &message : messages) {
+      intraComm.send(message.first, secondaryRank);
+      intraComm.sendRange(message.second, secondaryRank);
+    }
+  }
+  return std::move(mailbox[0]);
+}
+
+/**
+ * @brief Sends a message to each neighbor rank and returns the messages received from the neighbor ranks.
+ *
+ * Intra-participant communications based on sockets or MPI ports only connect the secondary ranks to
+ * the primary rank, which then relays the messages.
+ */
+std::map<Rank, std::vector<int>> exchangeWithNeighbors(const std::map<Rank, std::vector<int>> &outgoing)
+{
+  if (not utils::IntraComm::isParallel()) {
+    PRECICE_ASSERT(outgoing.empty());
+    return {};
+  }
+  if (utils::IntraComm::getCommunication()->connectsAllRanks()) {
+    return exchangeDirectly(outgoing);
+  }
+  return exchangeViaPrimary(outgoing);
+}
+
+/// Returns how many of numberOfVertices shared vertices each rank gets, such that the resulting vertex counts are as balanced as possible.
+/// The next vertex always goes to the rank with the lowest count, ties are broken in favor of the lower rank.
+std::vector<int> balancedShares(const std::vector<int> &vertexCounts, int numberOfVertices)
+{
+  std::vector<int> counts = vertexCounts;
+  std::vector<int> shares(counts.size(), 0);
+  for (int i = 0; i < numberOfVertices; ++i) {
+    auto lowest = std::min_element(counts.begin(), counts.end()) - counts.begin();
+    ++counts[lowest];
+    ++shares[lowest];
+  }
+  return shares;
+}
+} // namespace
+
 void ReceivedPartition::createOwnerInformation()
 {
   PRECICE_TRACE();
   Event e("partition.createOwnerInformation." + _mesh->getName(), precice::syncMode);
 
   /*
-    We follow different approaches for two-level and one-level methods. For 1LI, a centeralized
-    approach is followed, while the 2LI employs a local/parallel scheme for assigning vertices
-    to corresponding ranks.
-  */
-
-  if (m2n().usesTwoLevelInitialization()) {
-    /*
     This function ensures that each vertex is owned by only a single rank and
-    is not shared among ranks. Initially, the vertices are checked against the
-    bounding box of each rank. If a vertex fits into only a single bounding box,
-    the vertex is assigned to that rank. If it fits to various bbs, the rank with the
-    lowest number of vertices gets ownership to keep the load as balanced as
-    possible.
+    is not shared among ranks. The ownership is decided in a fully distributed
+    way for both, the one-level and the two-level initialization. No rank ever
+    handles data proportional to the global mesh size, neighboring ranks only
+    exchange the vertices they potentially share.
 
     Following steps are taken:
 
-    1- receive local bb map from primary rank
-    2- filter bb map to keep the connected ranks
-    3- own the vertices that only fit into this rank's bb
+    1- compute the bounding box around all tagged vertices of this rank
+    2- exchange the bounding boxes and keep the overlapping ones as neighbors
+    3- own the tagged vertices that only fit into this rank's bb
     4- send number of owned vertices and the list of shared vertices to neighbors
-    5- for the remaining vertices: check if we have less vertices -> own it!
-    */
+    5- distribute every group of vertices shared by the same set of ranks among
+       these ranks, such that the number of owned vertices is balanced
 
-    // #1: receive local bb map from primary rank
-    // Define and initialize localBBMap to save local bbs
+    Only tagged vertices are considered, as only these can be owned. If a vertex is
+    tagged on two ranks, it lies in the bounding boxes of both ranks. Hence, both
+    ranks learn from each other that they share the vertex and all ranks sharing
+    a vertex take the same decision.
+  */
 
-    mesh::Mesh::BoundingBoxMap localBBMap;
-    for (Rank rank = 0; rank < utils::IntraComm::getSize(); rank++) {
-      localBBMap.emplace(rank, mesh::BoundingBox(_dimensions));
+  // #1: bounding box around all tagged vertices of this rank
+  const int numberOfVertices = _mesh->vertices().size();
+  PRECICE_DEBUG("Tag vertices, number of vertices {}", numberOfVertices);
+  mesh::BoundingBox taggedBB(_dimensions);
+  for (const mesh::Vertex &vertex : _mesh->vertices()) {
+    if (vertex.isTagged()) {
+      taggedBB.expandBy(vertex);
     }
+  }
 
-    // Define a bb map to save the local connected ranks and respective boundingboxes
-    mesh::Mesh::BoundingBoxMap localConnectedBBMap;
-
-    // store global IDs and list of possible shared vertices
-
-    // Global IDs to be saved in:
-    std::vector<VertexID> sharedVerticesGlobalIDs;
-    // Local IDs to be saved in:
-    std::vector<VertexID> sharedVerticesLocalIDs;
-
-    // store possible shared vertices in a map to communicate with neighbors, map: rank -> vertex_global_id
-    mesh::Mesh::CommunicationMap sharedVerticesSendMap;
-
-    // receive list of possible shared vertices from neighboring ranks
-    mesh::Mesh::CommunicationMap sharedVerticesReceiveMap;
-
-    if (utils::IntraComm::isPrimary()) {
+  // #2: exchange bounding boxes and keep the connected ranks
+  // Define and initialize localBBMap to save local bbs
+  mesh::Mesh::BoundingBoxMap localBBMap;
+  for (Rank rank = 0; rank < utils::IntraComm::getSize(); rank++) {
+    localBBMap.emplace(rank, mesh::BoundingBox(_dimensions));
+  }
 
-      // Insert bounding box of primary ranks
-      localBBMap.at(0) = _bb;
+  if (utils::IntraComm::isPrimary()) {
 
-      // primary rank receives local bb from each secondary rank
-      for (int secondaryRank = 1; secondaryRank < utils::IntraComm::getSize(); secondaryRank++) {
-        com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).receiveBoundingBox(localBBMap.at(secondaryRank), secondaryRank);
-      }
+    // Insert bounding box of primary ranks
+    localBBMap.at(0) = taggedBB;
 
-      // primary rank broadcast localBBMap to all secondary ranks
-      com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).broadcastSendBoundingBoxMap(localBBMap);
-    } else if (utils::IntraComm::isSecondary()) {
-      // secondary ranks send local bb to primary rank
-      com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).sendBoundingBox(_bb, 0);
-      // secondary ranks receive localBBMap from primary rank
-      com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).broadcastReceiveBoundingBoxMap(localBBMap);
+    // primary rank receives local bb from each secondary rank
+    for (int secondaryRank = 1; secondaryRank < utils::IntraComm::getSize(); secondaryRank++) {
+      com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).receiveBoundingBox(localBBMap.at(secondaryRank), secondaryRank);
     }
 
-    // #2: filter bb map to keep the connected ranks
-    // remove the own bb from the map since we compare the own bb only with other ranks bb.
-    localBBMap.erase(utils::IntraComm::getRank());
-    // find and store local connected ranks
+    // primary rank broadcast localBBMap to all secondary ranks
+    com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).broadcastSendBoundingBoxMap(localBBMap);
+  } else if (utils::IntraComm::isSecondary()) {
+    // secondary ranks send local bb to primary rank
+    com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).sendBoundingBox(taggedBB, 0);
+    // secondary ranks receive localBBMap from primary rank
+    com::CommunicateBoundingBox(utils::IntraComm::getCommunication()).broadcastReceiveBoundingBoxMap(localBBMap);
+  }
+
+  // remove the own bb from the map since we compare the own bb only with other ranks bb.
+  localBBMap.erase(utils::IntraComm::getRank());
+  // Define a bb map to save the local connected ranks and respective boundingboxes
+  mesh::Mesh::BoundingBoxMap localConnectedBBMap;
+  if (not taggedBB.empty()) {
     for (const auto &localBB : localBBMap) {
-      if (_bb.overlapping(localBB.second)) {
+      if (not localBB.second.empty() && taggedBB.overlapping(localBB.second)) {
         localConnectedBBMap.emplace(localBB.first, localBB.second);
       }
     }
+  }
 
-    // #3: check vertices and keep only those that fit into the current rank's bb
-    const int numberOfVertices = _mesh->vertices().size();
-    PRECICE_DEBUG("Tag vertices, number of vertices {}", numberOfVertices);
-    std::vector<int>      tags(numberOfVertices, -1);
-    std::vector<VertexID> globalIDs(numberOfVertices, -1);
-    int                   ownedVerticesCount = 0; // number of vertices owned by this rank
-    for (int i = 0; i < numberOfVertices; i++) {
-      globalIDs[i] = _mesh->vertices()[i].getGlobalIndex();
-      if (_mesh->vertices()[i].isTagged()) {
-        bool vertexIsShared = false;
-        for (const auto &neighborRank : localConnectedBBMap) {
-          if (neighborRank.second.contains(_mesh->vertices()[i])) {
-            vertexIsShared = true;
-            sharedVerticesSendMap[neighborRank.first].push_back(globalIDs[i]);
-            sharedVerticesGlobalIDs.push_back(globalIDs[i]);
-            sharedVerticesLocalIDs.push_back(i);
-          }
-        }
-
-        if (not vertexIsShared) {
-          tags[i] = 1;
-          ownedVerticesCount++;
-        }
-      }
-
-      else {
-        tags[i] = 0;
-      }
-    }
-
-    // #4: Exchange number of already owned vertices with the neighbors
-
-    // to store receive requests.
-    std::vector<com::PtrRequest> vertexNumberRequests;
-
-    // Define and initialize for load balancing
-    std::map<int, int> neighborRanksVertexCount;
-    for (auto &neighborRank : localConnectedBBMap) {
-      neighborRanksVertexCount.emplace(neighborRank.first, 0);
+  // #3: own the vertices that only fit into the current rank's bb
+  std::vector<int> tags(numberOfVertices, 0);
+  // Local IDs of possibly shared vertices
+  std::vector<VertexID> sharedVerticesLocalIDs;
+  // store possible shared vertices in a map to communicate with neighbors, map: rank -> vertex_global_id
+  mesh::Mesh::CommunicationMap sharedVerticesSendMap;
+  int                          ownedVerticesCount = 0; // number of vertices owned by this rank
+  for (int i = 0; i < numberOfVertices; i++) {
+    const mesh::Vertex &vertex = _mesh->vertices()[i];
+    if (not vertex.isTagged()) {
+      continue;
     }
-
-    // Asynchronous receive number of owned vertices from neighbor ranks
-    for (auto &neighborRank : localConnectedBBMap) {
-      auto request = utils::IntraComm::getCommunication()->aReceive(neighborRanksVertexCount.at(neighborRank.first), neighborRank.first);
-      vertexNumberRequests.push_back(request);
+    bool vertexIsShared = false;
+    for (const auto &neighborRank : localConnectedBBMap) {
+      if (neighborRank.second.contains(vertex)) {
+        vertexIsShared = true;
+        sharedVerticesSendMap[neighborRank.first].push_back(vertex.getGlobalIndex());
+      }
     }
 
-    // Synchronous send number of owned vertices to neighbor ranks
-    for (auto &neighborRank : localConnectedBBMap) {
-      utils::IntraComm::getCommunication()->send(ownedVerticesCount, neighborRank.first);
+    if (vertexIsShared) {
+      sharedVerticesLocalIDs.push_back(i);
+    } else {
+      tags[i] = 1;
+      ownedVerticesCount++;
     }
+  }
 
-    // wait until all aReceives are complete.
-    for (auto &rqst : vertexNumberRequests) {
-      rqst->wait();
+  // #4: Exchange the number of already owned vertices and the list of shared vertices with the neighbors
+  // Every neighbor gets a message {owned vertex count, shared global vertex IDs...}
+  std::map<Rank, std::vector<int>> outgoing;
+  for (const auto &neighborRank : localConnectedBBMap) {
+    auto &message = outgoing[neighborRank.first];
+    message.push_back(ownedVerticesCount);
+    const auto &sendList = sharedVerticesSendMap[neighborRank.first];
+    message.insert(message.end(), sendList.begin(), sendList.end());
+  }
+  auto incoming = exchangeWithNeighbors(outgoing);
+
+  std::map<int, int>           neighborRanksVertexCount;
+  mesh::Mesh::CommunicationMap sharedVerticesReceiveMap; // sorted for lookups
+  for (auto &message : incoming) {
+    PRECICE_ASSERT(not message.second.empty());
+    neighborRanksVertexCount.emplace(message.first, message.second.front());
+    if (message.second.size() > 1) {
+      std::vector<int> receivedSharedVertices(message.second.begin() + 1, message.second.end());
+      std::sort(receivedSharedVertices.begin(), receivedSharedVertices.end());
+      sharedVerticesReceiveMap.emplace(message.first, std::move(receivedSharedVertices));
     }
+  }
 
-    // Exchange list of shared vertices with the neighbor
-    // to store send requests.
-    std::vector<com::PtrRequest> vertexListRequests;
+  // #5: Distribute the shared vertices according to the number of owned vertices
 
-    for (auto &receivingRank : sharedVerticesSendMap) {
-      int  sendSize = receivingRank.second.size();
-      auto request  = utils::IntraComm::getCommunication()->aSend(sendSize, receivingRank.first);
-      vertexListRequests.push_back(request);
-      if (sendSize != 0) {
-        auto request = utils::IntraComm::getCommunication()->aSend(span<const int>{receivingRank.second}, receivingRank.first);
-        vertexListRequests.push_back(request);
+  /* All vertices which are shared by the same set of ranks form a group. Every rank of the
+     group knows the group and the number of already owned vertices of all other group members.
+     The vertices of a group are sorted by their global index and handed out in contiguous chunks.
+     The chunk sizes are chosen such that the ranks with lower vertex count get more vertices.
+     If two ranks have the same vertex count, the lower rank gets the vertex.
+  */
+  std::map<std::vector<Rank>, std::vector<VertexID>> sharedVertexGroups; // sharing ranks -> {local vertex index}
+  for (VertexID localID : sharedVerticesLocalIDs) {
+    const VertexID    globalID = _mesh->vertices()[localID].getGlobalIndex();
+    std::vector<Rank> sharingRanks{utils::IntraComm::getRank()};
+    for (const auto &sharingRank : sharedVerticesReceiveMap) {
+      if (std::binary_search(sharingRank.second.begin(), sharingRank.second.end(), globalID)) {
+        sharingRanks.push_back(sharingRank.first);
       }
     }
+    std::sort(sharingRanks.begin(), sharingRanks.end());
+    sharedVertexGroups[sharingRanks].push_back(localID);
+  }
 
-    for (auto &neighborRank : sharedVerticesSendMap) {
-      int receiveSize = 0;
-      utils::IntraComm::getCommunication()->receive(receiveSize, neighborRank.first);
-      if (receiveSize != 0) {
-        std::vector<int> receivedSharedVertices(receiveSize, -1);
-        utils::IntraComm::getCommunication()->receive(span<int>{receivedSharedVertices}, neighborRank.first);
-        sharedVerticesReceiveMap.insert(std::make_pair(neighborRank.first, receivedSharedVertices));
-      }
-    }
+  for (auto &group : sharedVertexGroups) {
+    const auto &sharingRanks = group.first;
+    auto &      localIDs     = group.second;
+    std::sort(localIDs.begin(), localIDs.end(), [this](VertexID lhs, VertexID rhs) {
+      return _mesh->vertices()[lhs].getGlobalIndex() < _mesh->vertices()[rhs].getGlobalIndex();
+    });
 
-    // wait until all aSends are complete.
-    for (auto &rqst : vertexListRequests) {
-      rqst->wait();
-    }
-
-    // #5: Second round assignment according to the number of owned vertices
-
-    /* In case that a vertex can be shared between two ranks, the rank with lower
-       vertex count will own the vertex.
-       If both ranks have same vertex count, the lower rank will own the vertex.
-    */
-
-    for (size_t i = 0; i < sharedVerticesGlobalIDs.size(); i++) {
-      bool owned = true;
-
-      for (auto &sharingRank : sharedVerticesReceiveMap) {
-        std::vector<int> vec = sharingRank.second;
-        if (std::find(vec.begin(), vec.end(), sharedVerticesGlobalIDs[i]) != vec.end()) {
-          if ((ownedVerticesCount > neighborRanksVertexCount[sharingRank.first]) ||
-              (ownedVerticesCount == neighborRanksVertexCount[sharingRank.first] && utils::IntraComm::getRank() > sharingRank.first)) {
-            owned = false;
-
-            // // Decide upon owners,
-            // PRECICE_DEBUG("Decide owners, first round by rough load balancing");
-            // // Provide a more descriptive error message if direct access was enabled
-            // PRECICE_CHECK(!(ranksAtInterface == 0 && _allowDirectAccess),
-            //               "After repartitioning of mesh \"{}\" all ranks are empty. "
-            //               "Please check the dimensions of the provided bounding box "
-            //               "(in \"setMeshAccessRegion\") and verify that it covers vertices "
-            //               "in the mesh or check the definition of the provided meshes.",
-            //               _mesh->getName());
-            // PRECICE_ASSERT(ranksAtInterface != 0);
-            // int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; // Guess for a decent load balancing
-            // // First round: every secondary rank gets localGuess vertices
-            // for (Rank rank : utils::IntraComm::allRanks()) {
-            //   int counter = 0;
-            //   for (size_t i = 0; i < secondaryOwnerVecs[rank].size(); i++) {
-            //     // Vertex has no owner yet and rank could be owner
-            //     if (globalOwnerVec[secondaryGlobalIDs[rank][i]] == 0 && secondaryTags[rank][i] == 1) {
-            //       secondaryOwnerVecs[rank][i]                 = 1; // Now rank is owner
-            //       globalOwnerVec[secondaryGlobalIDs[rank][i]] = 1; // Vertex now has owner
-            //       counter++;
-            //       if (counter == localGuess)
-
-            break;
-          }
-        }
-      }
-      tags[sharedVerticesLocalIDs[i]] = owned ? 1 : 0;
+    std::vector<int> vertexCounts;
+    for (Rank rank : sharingRanks) {
+      vertexCounts.push_back(rank == utils::IntraComm::getRank() ? ownedVerticesCount : neighborRanksVertexCount.at(rank));
     }
+    const auto shares = balancedShares(vertexCounts, localIDs.size());
 
-    setOwnerInformation(tags);
-    auto filteredVertices = std::count(tags.begin(), tags.end(), 0);
-    if (filteredVertices)
-      PRECICE_WARN("{} of {} vertices of mesh {} have been filtered out since they have no influence on the mapping.",
-                   filteredVertices, _mesh->getGlobalNumberOfVertices(), _mesh->getName());
-    // end of two-level initialization section
-  } else {
-    if (utils::IntraComm::isSecondary()) {
-      int numberOfVertices = _mesh->vertices().size();
-      utils::IntraComm::getCommunication()->send(numberOfVertices, 0);
-
-      if (numberOfVertices != 0) {
-        PRECICE_DEBUG("Tag vertices, number of vertices {}", numberOfVertices);
-        std::vector<int>      tags(numberOfVertices, -1);
-        std::vector<VertexID> globalIDs(numberOfVertices, -1);
-        bool                  atInterface = false;
-        for (int i = 0; i < numberOfVertices; i++) {
-          globalIDs[i] = _mesh->vertices()[i].getGlobalIndex();
-          if (_mesh->vertices()[i].isTagged()) {
-            tags[i]     = 1;
-            atInterface = true;
-          } else {
-            tags[i] = 0;
-          }
-        }
-        PRECICE_DEBUG("My tags: {}", tags);
-        PRECICE_DEBUG("My global IDs: {}", globalIDs);
-        PRECICE_DEBUG("Send tags and global IDs");
-        utils::IntraComm::getCommunication()->sendRange(tags, 0);
-        utils::IntraComm::getCommunication()->sendRange(globalIDs, 0);
-        utils::IntraComm::getCommunication()->send(atInterface, 0);
-
-        PRECICE_DEBUG("Receive owner information");
-        std::vector<VertexID> ownerVec = utils::IntraComm::getCommunication()->receiveRange(0, com::AsVectorTag<VertexID>{});
-        PRECICE_DEBUG("My owner information: {}", ownerVec);
-        PRECICE_ASSERT(ownerVec.size() == static_cast<std::size_t>(numberOfVertices));
-        setOwnerInformation(ownerVec);
-      }
+    const auto myPosition = std::find(sharingRanks.begin(), sharingRanks.end(), utils::IntraComm::getRank()) - sharingRanks.begin();
+    const auto begin      = std::accumulate(shares.begin(), shares.begin() + myPosition, 0);
+    for (int i = begin; i < begin + shares[myPosition]; ++i) {
+      tags[localIDs[i]] = 1;
     }
+  }
 
-    else if (utils::IntraComm::isPrimary()) {
-      // To temporary store which vertices already have an owner
-      std::vector<VertexID> globalOwnerVec(_mesh->getGlobalNumberOfVertices(), 0);
-      // The same per rank
-      std::vector<std::vector<VertexID>> secondaryOwnerVecs(utils::IntraComm::getSize());
-      // Global IDs per rank
-      std::vector<std::vector<VertexID>> secondaryGlobalIDs(utils::IntraComm::getSize());
-      // Tag information per rank
-      std::vector<std::vector<int>> secondaryTags(utils::IntraComm::getSize());
-
-      // Fill primary data
-      PRECICE_DEBUG("Tag vertices of primary rank");
-      bool primaryRankAtInterface = false;
-      secondaryOwnerVecs[0].resize(_mesh->vertices().size());
-      secondaryGlobalIDs[0].resize(_mesh->vertices().size());
-      secondaryTags[0].resize(_mesh->vertices().size());
-      for (size_t i = 0; i < _mesh->vertices().size(); i++) {
-        secondaryGlobalIDs[0][i] = _mesh->vertices()[i].getGlobalIndex();
-        if (_mesh->vertices()[i].isTagged()) {
-          primaryRankAtInterface = true;
-          secondaryTags[0][i]    = 1;
-        } else {
-          secondaryTags[0][i] = 0;
-        }
-      }
-      PRECICE_DEBUG("My tags: {}", secondaryTags[0]);
-
-      // receive secondary data
-      Rank ranksAtInterface = 0;
-      if (primaryRankAtInterface)
-        ranksAtInterface++;
-
-      for (Rank rank : utils::IntraComm::allSecondaryRanks()) {
-        int localNumberOfVertices = -1;
-        utils::IntraComm::getCommunication()->receive(localNumberOfVertices, rank);
-        PRECICE_DEBUG("Rank {} has {} vertices.", rank, localNumberOfVertices);
-        secondaryOwnerVecs[rank].resize(localNumberOfVertices, 0);
-
-        if (localNumberOfVertices != 0) {
-          PRECICE_DEBUG("Receive tags from secondary rank {}", rank);
-          secondaryTags[rank]      = utils::IntraComm::getCommunication()->receiveRange(rank, com::AsVectorTag<int>{});
-          secondaryGlobalIDs[rank] = utils::IntraComm::getCommunication()->receiveRange(rank, com::AsVectorTag<VertexID>{});
-          PRECICE_DEBUG("Rank {} has tags {}", rank, secondaryTags[rank]);
-          PRECICE_DEBUG("Rank {} has global IDs {}", rank, secondaryGlobalIDs[rank]);
-          bool atInterface = false;
-          utils::IntraComm::getCommunication()->receive(atInterface, rank);
-          if (atInterface)
-            ranksAtInterface++;
-        }
-      }
-
-      // Decide upon owners,
-      PRECICE_DEBUG("Decide owners, first round by rough load balancing");
-      // Provide a more descriptive error message if direct access was enabled
-      PRECICE_CHECK(!(ranksAtInterface == 0 && _allowDirectAccess),
-                    "After repartitioning of mesh \"{}\" all ranks are empty. "
-                    "Please check the dimensions of the provided bounding box "
-                    "(in \"setMeshAccessRegion\") and verify that it covers vertices "
-                    "in the mesh or check the definition of the provided meshes.",
-                    _mesh->getName());
-      PRECICE_ASSERT(ranksAtInterface != 0);
-      int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; // Guess for a decent load balancing
-      // First round: every secondary rank gets localGuess vertices
-      for (Rank rank : utils::IntraComm::allRanks()) {
-        int counter = 0;
-        for (size_t i = 0; i < secondaryOwnerVecs[rank].size(); i++) {
-          // Vertex has no owner yet and rank could be owner
-          if (globalOwnerVec[secondaryGlobalIDs[rank][i]] == 0 && secondaryTags[rank][i] == 1) {
-            secondaryOwnerVecs[rank][i]                 = 1; // Now rank is owner
-            globalOwnerVec[secondaryGlobalIDs[rank][i]] = 1; // Vertex now has owner
-            counter++;
-            if (counter == localGuess)
-              break;
-          }
-        }
-      }
-
-      // Second round: distribute all other vertices in a greedy way
-      PRECICE_DEBUG("Decide owners, second round in greedy way");
-      for (Rank rank : utils::IntraComm::allRanks()) {
-        for (size_t i = 0; i < secondaryOwnerVecs[rank].size(); i++) {
-          if (globalOwnerVec[secondaryGlobalIDs[rank][i]] == 0 && secondaryTags[rank][i] == 1) {
-            secondaryOwnerVecs[rank][i]                 = 1;
-            globalOwnerVec[secondaryGlobalIDs[rank][i]] = rank + 1;
-          }
-        }
-      }
-
-      // Send information back to secondary ranks
-      for (Rank rank : utils::IntraComm::allSecondaryRanks()) {
-        if (not secondaryTags[rank].empty()) {
-          PRECICE_DEBUG("Send owner information to secondary rank {}", rank);
-          utils::IntraComm::getCommunication()->sendRange(secondaryOwnerVecs[rank], rank);
-        }
-      }
-      // Primary rank data
-      PRECICE_DEBUG("My owner information: {}", secondaryOwnerVecs[0]);
-      setOwnerInformation(secondaryOwnerVecs[0]);
-
-#ifndef NDEBUG
-      for (size_t i = 0; i < globalOwnerVec.size(); i++) {
-        if (globalOwnerVec[i] == 0) {
-          PRECICE_DEBUG("The Vertex with global index {} of mesh: {} was completely filtered out, since it has no influence on any mapping.",
-                        i, _mesh->getName());
-        }
-      }
-#endif
-      auto filteredVertices = std::count(globalOwnerVec.begin(), globalOwnerVec.end(), 0);
-      if (filteredVertices) {
-        PRECICE_WARN("{} of {} vertices of mesh {} have been filtered out since they have no influence on the mapping.{}",
-                     filteredVertices, _mesh->getGlobalNumberOfVertices(), _mesh->getName(),
-                     _allowDirectAccess ? " Associated data values of the filtered vertices will be filled with zero values in order to "
-                                          "provide valid data for other participants when reading data."
-                                        : "");
-      }
-    }
+  setOwnerInformation(tags);
+
+  int localOwned  = std::count(tags.begin(), tags.end(), 1);
+  int globalOwned = 0;
+  utils::IntraComm::allreduceSum(localOwned, globalOwned);
+
+  // Provide a more descriptive error message if direct access was enabled
+  PRECICE_CHECK(!(globalOwned == 0 && _allowDirectAccess),
+                "After repartitioning of mesh \"{}\" all ranks are empty. "
+                "Please check the dimensions of the provided bounding box "
+                "(in \"setMeshAccessRegion\") and verify that it covers vertices "
+                "in the mesh or check the definition of the provided meshes.",
+                _mesh->getName());
+
+  auto filteredVertices = _mesh->getGlobalNumberOfVertices() - globalOwned;
+  if (utils::IntraComm::isPrimary() && filteredVertices > 0) {
+    PRECICE_WARN("{} of {} vertices of mesh {} have been filtered out since they have no influence on the mapping.{}",
+                 filteredVertices, _mesh->getGlobalNumberOfVertices(), _mesh->getName(),
+                 _allowDirectAccess ? " Associated data values of the filtered vertices will be filled with zero values in order to "
+                                      "provide valid data for other participants when reading data."
+                                    : "");
   }
 }
 
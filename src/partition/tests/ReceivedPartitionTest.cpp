@@ -679,7 +679,7 @@ BOOST_AUTO_TEST_CASE(RePartitionRBFLocal3D)
         BOOST_TEST(pSolidzMesh->vertices().at(0).isOwner() == true);
         BOOST_TEST(pSolidzMesh->vertices().at(1).isOwner() == true);
         BOOST_TEST(pSolidzMesh->vertices().at(2).isOwner() == false);
-        BOOST_TEST(pSolidzMesh->vertices().at(3).isOwner() == false);
+        BOOST_TEST(pSolidzMesh->vertices().at(3).isOwner() == true);
         BOOST_TEST(pSolidzMesh->vertices().at(4).isOwner() == false);
         BOOST_TEST(pSolidzMesh->vertices().at(0).getGlobalIndex() == 0);
         BOOST_TEST(pSolidzMesh->vertices().at(1).getGlobalIndex() == 1);
@@ -697,7 +697,7 @@ BOOST_AUTO_TEST_CASE(RePartitionRBFLocal3D)
         BOOST_TEST(pSolidzMesh->vertices().at(0).isOwner() == false);
         BOOST_TEST(pSolidzMesh->vertices().at(1).isOwner() == false);
         BOOST_TEST(pSolidzMesh->vertices().at(2).isOwner() == true);
-        BOOST_TEST(pSolidzMesh->vertices().at(3).isOwner() == true);
+        BOOST_TEST(pSolidzMesh->vertices().at(3).isOwner() == false);
         BOOST_TEST(pSolidzMesh->vertices().at(4).isOwner() == true);
         BOOST_TEST(pSolidzMesh->vertices().at(0).getGlobalIndex() == 0);
         BOOST_TEST(pSolidzMesh->vertices().at(1).getGlobalIndex() == 1);
@@ -1459,6 +1459,39 @@ BOOST_AUTO_TEST_CASE(parallelSetOwnerInformationEmptyPartition)
   }
 }
 
+BOOST_AUTO_TEST_CASE(parallelSetOwnerInformationBalanced)
+{
+  /*
+    This test examines the load balancing of the parallel setOwnerinformation function in receivedpartition.cpp.
+    All ranks receive the same eight vertices, hence all vertices are shared among all ranks and no rank owns
+    any vertex beforehand. The vertices must be distributed evenly in contiguous chunks of global indices,
+    i.e. rank r owns the vertices with global indices 2r and 2r+1.
+   */
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm(), Require::Events);
+  //mesh creation
+  int           dimensions = 2;
+  mesh::PtrMesh mesh(new mesh::Mesh("mesh", dimensions, testing::nextMeshID()));
+
+  for (int i = 0; i < 8; ++i) {
+    Eigen::VectorXd position(dimensions);
+    position << i, 0.0;
+    mesh->createVertex(position);
+  }
+
+  mesh->computeBoundingBox();
+  mesh->setGlobalNumberOfVertices(mesh->vertices().size());
+
+  for (auto &vertex : mesh->vertices()) {
+    vertex.setGlobalIndex(vertex.getID());
+  }
+
+  testParallelSetOwnerInformation(mesh, dimensions);
+
+  for (auto &vertex : mesh->vertices()) {
+    BOOST_TEST(vertex.isOwner() == (vertex.getGlobalIndex() / 2 == context.rank));
+  }
+}
+
 // Test with two "from" and two "to" mappings
 BOOST_AUTO_TEST_CASE(RePartitionMultipleMappings)
 {
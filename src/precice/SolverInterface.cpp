@@ -42,6 +42,17 @@ double SolverInterface::advance(
   return _impl->advance(computedTimestepLength);
 }
 
+void SolverInterface::startAdvance(
+    double computedTimestepLength)
+{
+  _impl->startAdvance(computedTimestepLength);
+}
+
+double SolverInterface::completeAdvance()
+{
+  return _impl->completeAdvance();
+}
+
 void SolverInterface::finalize()
 {
   return _impl->finalize();
@@ -163,6 +174,15 @@ void SolverInterface::setMeshVertices(
   _impl->setMeshVertices(meshID, size, positions, ids);
 }
 
+void SolverInterface::moveMeshVertices(
+    int           meshID,
+    int           size,
+    const int *   ids,
+    const double *positions)
+{
+  _impl->moveMeshVertices(meshID, size, ids, positions);
+}
+
 void SolverInterface::getMeshVertices(
     int        meshID,
     int        size,
@@ -1248,6 +1248,94 @@ public:
 
   ///@}
 
+  /** @name Experimental: Moving Meshes
+   * These API functions are \b experimental and may change in future versions.
+   */
+  ///@{
+
+  /**
+   * @brief Moves vertices of a provided mesh after initialize() has been called.
+   *
+   * @experimental
+   *
+   * Instead of resetting the mesh and re-initializing the coupling, preCICE updates the
+   * spatial index of the mesh incrementally and updates the mappings from and to the mesh.
+   * Nearest-neighbor mappings only recompute the matches of the moved vertices, all other
+   * mappings are recomputed before they are used the next time.
+   *
+   * The vertices should stay within the region used to filter the received meshes,
+   * which is the bounding box of the provided mesh at initialization enlarged by the safety factor.
+   * Watch points keep the interpolation computed in initialize().
+   *
+   * @param[in] meshID the id of the mesh to move the vertices of
+   * @param[in] size Number of vertices to move
+   * @param[in] ids The ids of the vertices to move
+   * @param[in] positions a pointer to the new coordinates of the vertices
+   *            The 2D-format is (d0x, d0y, d1x, d1y, ..., dnx, dny)
+   *            The 3D-format is (d0x, d0y, d0z, d1x, d1y, d1z, ..., dnx, dny, dnz)
+   *
+   * @pre initialize() has been called
+   * @pre the mesh is provided by this participant and not received by any other participant
+   * @pre count of available elements at positions matches the configured dimension * size
+   * @pre count of available elements at ids matches size
+   *
+   * @see getDimensions()
+   */
+  void moveMeshVertices(
+      int           meshID,
+      int           size,
+      const int *   ids,
+      const double *positions);
+
+  ///@}
+
+  /** @name Experimental: Split-phase Advance
+   * These API functions are \b experimental and may change in future versions.
+   */
+  ///@{
+
+  /**
+   * @brief Starts to advance to the next (time)step, which is completed by completeAdvance().
+   *
+   * @experimental
+   *
+   * Performs the first part of advance(), which maps the written data, and starts the data
+   * exchange, the acceleration, and the mapping of the read data in a background thread.
+   * Meanwhile, the solver can compute everything, which does not depend on the coupling data.
+   *
+   * The exchange runs in the background only, if MPI allows preCICE to communicate from another
+   * thread. If preCICE initializes MPI, it requests the required thread support itself. Otherwise,
+   * the solver needs to initialize MPI with MPI_THREAD_MULTIPLE. If MPI does not provide this,
+   * the exchange is deferred to completeAdvance().
+   *
+   * @param[in] computedTimestepLength Length of timestep used by the solver.
+   *
+   * @pre The same preconditions as for advance() apply.
+   *
+   * @post No other API function may be called before completeAdvance().
+   *
+   * @see advance()
+   */
+  void startAdvance(double computedTimestepLength);
+
+  /**
+   * @brief Completes the advance started by startAdvance().
+   *
+   * @experimental
+   *
+   * Waits for the data exchange and performs the remaining part of advance().
+   * Afterwards, the interface is in the same state as after calling advance().
+   *
+   * @pre startAdvance() has been called.
+   *
+   * @return Maximum length of next timestep to be computed by solver.
+   *
+   * @see startAdvance()
+   */
+  double completeAdvance();
+
+  ///@}
+
   /// Disable copy construction
   SolverInterface(const SolverInterface &copy) = delete;
 
@@ -619,14 +619,14 @@ void ParticipantConfiguration::finishParticipantConfiguration(
                        "Note that this will export as PVTU instead. For consistency, prefer \"<export:vtu ... />\" instead.",
                        participant->getName());
         }
-        exporter = io::PtrExport(new io::ExportVTU());
+        exporter = io::PtrExport(new io::ExportVTU(exportContext.ranksPerFile));
       } else {
         exporter = io::PtrExport(new io::ExportVTK());
       }
     } else if (exportContext.type == VALUE_VTU) {
-      exporter = io::PtrExport(new io::ExportVTU());
+      exporter = io::PtrExport(new io::ExportVTU(exportContext.ranksPerFile));
     } else if (exportContext.type == VALUE_VTP) {
-      exporter = io::PtrExport(new io::ExportVTP());
+      exporter = io::PtrExport(new io::ExportVTP(exportContext.ranksPerFile));
     } else if (exportContext.type == VALUE_CSV) {
       exporter = io::PtrExport(new io::ExportCSV());
     } else {
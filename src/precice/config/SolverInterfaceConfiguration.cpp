@@ -32,6 +32,25 @@ SolverInterfaceConfiguration::SolverInterfaceConfiguration(xml::XMLTag &parent)
   auto attrExperimental = makeXMLAttribute("experimental", false)
                               .setDocumentation("Enable experimental features.");
   tag.addAttribute(attrExperimental);
+  auto attrThreads = makeXMLAttribute("threads", 1)
+                         .setDocumentation("Number of threads per rank, which preCICE uses for mappings and queries. "
+                                           "This includes the thread of the solver. A single thread disables multithreading.");
+  tag.addAttribute(attrThreads);
+  auto attrPinThreads = makeXMLAttribute("pin-threads", false)
+                            .setDocumentation("Pin the additional threads of preCICE to the cores following the core of the solver thread. "
+                                              "Only supported on Linux.");
+  tag.addAttribute(attrPinThreads);
+  auto attrCheckpointInterval = makeXMLAttribute("checkpoint-interval", 0)
+                                    .setDocumentation("Write a checkpoint of the coupling state every given number of time windows, which allows to restart the coupled simulation. "
+                                                      "Every rank writes its own file. The value 0 disables checkpoints.");
+  tag.addAttribute(attrCheckpointInterval);
+  auto attrCheckpointDirectory = makeXMLAttribute("checkpoint-directory", ".")
+                                     .setDocumentation("Directory the checkpoints are written to and read from.");
+  tag.addAttribute(attrCheckpointDirectory);
+  auto attrRestart = makeXMLAttribute("restart-from-checkpoint", false)
+                         .setDocumentation("Restart the coupled simulation from the last checkpoint in the checkpoint directory. "
+                                           "All participants need to restart with the number of ranks of the run, which wrote the checkpoint.");
+  tag.addAttribute(attrRestart);
 
   _dataConfiguration = std::make_shared<mesh::DataConfiguration>(
       tag);
@@ -58,6 +77,19 @@ void SolverInterfaceConfiguration::xmlTagCallback(
     _meshConfiguration->setDimensions(_dimensions);
     _participantConfiguration->setDimensions(_dimensions);
     _experimental = tag.getBooleanAttributeValue("experimental");
+    _threads      = tag.getIntAttributeValue("threads");
+    PRECICE_CHECK(_threads > 0,
+                  "The number of threads has to be positive, but is {}. "
+                  "Please set the attribute \"threads\" of the solver-interface tag to 1 to disable multithreading.",
+                  _threads);
+    _pinThreads         = tag.getBooleanAttributeValue("pin-threads");
+    _checkpointInterval = tag.getIntAttributeValue("checkpoint-interval");
+    PRECICE_CHECK(_checkpointInterval >= 0,
+                  "The checkpoint interval has to be non-negative, but is {}. "
+                  "Please set the attribute \"checkpoint-interval\" of the solver-interface tag to 0 to disable checkpoints.",
+                  _checkpointInterval);
+    _checkpointDirectory = tag.getStringAttributeValue("checkpoint-directory");
+    _restart             = tag.getBooleanAttributeValue("restart-from-checkpoint");
     _couplingSchemeConfiguration->setExperimental(_experimental);
     _participantConfiguration->setExperimental(_experimental);
   } else {
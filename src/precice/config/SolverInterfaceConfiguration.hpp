@@ -51,6 +51,36 @@ public:
     return _experimental;
   }
 
+  /// Returns the number of threads per rank including the solver thread
+  int getThreads() const
+  {
+    return _threads;
+  }
+
+  /// Returns whether the threads should be pinned to cores
+  bool pinsThreads() const
+  {
+    return _pinThreads;
+  }
+
+  /// Returns the number of time windows between two checkpoints, 0 if checkpoints are disabled
+  int getCheckpointInterval() const
+  {
+    return _checkpointInterval;
+  }
+
+  /// Returns the directory of the checkpoints
+  const std::string &getCheckpointDirectory() const
+  {
+    return _checkpointDirectory;
+  }
+
+  /// Returns whether the coupled simulation restarts from a checkpoint
+  bool restartsFromCheckpoint() const
+  {
+    return _restart;
+  }
+
   const mesh::PtrDataConfiguration getDataConfiguration() const
   {
     return _dataConfiguration;
@@ -106,6 +136,16 @@ private:
   /// Allow the use of experimental features
   bool _experimental = false;
 
+  int _threads = 1;
+
+  bool _pinThreads = false;
+
+  int _checkpointInterval = 0;
+
+  std::string _checkpointDirectory = ".";
+
+  bool _restart = false;
+
   // @brief Participating solvers in the coupled simulation.
   //std::vector<impl::PtrParticipant> _participants;
 
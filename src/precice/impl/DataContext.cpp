@@ -1,4 +1,5 @@
 #include "precice/impl/DataContext.hpp"
+#include <algorithm>
 #include <memory>
 #include "utils/EigenHelperFunctions.hpp"
 
@@ -116,6 +117,18 @@ void DataContext::mapData()
   }
 }
 
+bool DataContext::hasRankLocalMappings() const
+{
+  return std::all_of(_mappingContexts.begin(), _mappingContexts.end(), [](const MappingContext &context) { return context.mapping->isRankLocal(); });
+}
+
+bool DataContext::sharesMappedDataWith(const DataContext &other) const
+{
+  return std::any_of(_toData.begin(), _toData.end(), [&other](const mesh::PtrData &data) {
+    return std::find(other._toData.begin(), other._toData.end(), data) != other._toData.end();
+  });
+}
+
 bool DataContext::hasReadMapping() const
 {
   return std::any_of(_toData.begin(), _toData.end(), [this](auto &data) { return data == _providedData; });
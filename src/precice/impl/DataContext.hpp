@@ -72,6 +72,12 @@ public:
    */
   void mapData();
 
+  /// Returns true, if all mappings of this context are rank local, see mapping::Mapping::isRankLocal()
+  bool hasRankLocalMappings() const;
+
+  /// Returns true, if this context and the given context map to common data
+  bool sharesMappedDataWith(const DataContext &other) const;
+
   /**
    * @brief Adds a MappingContext and the MeshContext required by the mapping to the corresponding DataContext data structures.
    *
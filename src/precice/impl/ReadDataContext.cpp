@@ -51,4 +51,14 @@ void ReadDataContext::moveToNextWindow()
   _waveform->moveToNextWindow();
 }
 
+void ReadDataContext::exportState(io::CheckpointWriter &writer) const
+{
+  _waveform->exportState(writer);
+}
+
+void ReadDataContext::importState(io::CheckpointReader &reader)
+{
+  _waveform->importState(reader);
+}
+
 } // namespace precice::impl
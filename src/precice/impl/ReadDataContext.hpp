@@ -8,6 +8,11 @@
 #include "time/Time.hpp"
 
 namespace precice {
+namespace io {
+class CheckpointReader;
+class CheckpointWriter;
+} // namespace io
+
 namespace impl {
 
 /**
@@ -70,6 +75,16 @@ public:
    */
   void storeDataInWaveform();
 
+  /**
+   * @brief Writes the samples of _waveform to a checkpoint.
+   */
+  void exportState(io::CheckpointWriter &writer) const;
+
+  /**
+   * @brief Restores the samples of _waveform from a checkpoint, the waveform has to be initialized.
+   */
+  void importState(io::CheckpointReader &reader);
+
 private:
   static logging::Logger _log;
 
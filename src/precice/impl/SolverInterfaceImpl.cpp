@@ -4,6 +4,7 @@
 #include <cmath>
 #include <deque>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <ostream>
@@ -17,6 +18,8 @@
 #include "com/SharedPointer.hpp"
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/config/CouplingSchemeConfiguration.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "io/Export.hpp"
 #include "io/ExportContext.hpp"
 #include "io/SharedPointer.hpp"
@@ -66,6 +69,7 @@
 #include "utils/Parallel.hpp"
 #include "utils/Petsc.hpp"
 #include "utils/PointerVector.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/assertion.hpp"
 #include "xml/XMLTag.hpp"
@@ -220,6 +224,10 @@ void SolverInterfaceImpl::configure(
   _dimensions         = config.getDimensions();
   _allowsExperimental = config.allowsExperimental();
   _accessor           = determineAccessingParticipant(config);
+  utils::ThreadPool::instance().configure(config.getThreads(), config.pinsThreads());
+  _checkpointInterval    = config.getCheckpointInterval();
+  _checkpointDirectory   = config.getCheckpointDirectory();
+  _restartFromCheckpoint = config.restartsFromCheckpoint();
   _accessor->setMeshIdManager(config.getMeshConfiguration()->extractMeshIdManager());
 
   PRECICE_ASSERT(_accessorCommunicatorSize == 1 || _accessor->useIntraComm(),
@@ -320,21 +328,26 @@ double SolverInterfaceImpl::initialize()
     watchIntegral->initialize();
   }
 
-  // Initialize coupling state, overwrite these values for restart
-  double time       = 0.0;
-  int    timeWindow = 1;
-
-  PRECICE_DEBUG("Initialize coupling schemes");
-  _couplingScheme->initialize(time, timeWindow);
-  PRECICE_ASSERT(_couplingScheme->isInitialized());
+  if (_restartFromCheckpoint) {
+    restartFromCheckpoint();
+  } else {
+    // Initialize coupling state
+    double time       = 0.0;
+    int    timeWindow = 1;
 
-  double dt = _couplingScheme->getNextTimestepMaxLength();
+    PRECICE_DEBUG("Initialize coupling schemes");
+    _couplingScheme->initialize(time, timeWindow);
+    PRECICE_ASSERT(_couplingScheme->isInitialized());
 
-  for (auto &context : _accessor->readDataContexts()) {
-    context.initializeWaveform();
+    for (auto &context : _accessor->readDataContexts()) {
+      context.initializeWaveform();
+    }
   }
 
-  if (_couplingScheme->hasDataBeenReceived()) {
+  double dt = _couplingScheme->getNextTimestepMaxLength();
+
+  // The restored read data has to be mapped as well, as mapped data is not part of the checkpoint
+  if (_couplingScheme->hasDataBeenReceived() || _hasRestarted) {
     performDataActions({action::Action::READ_MAPPING_PRIOR}, 0.0, 0.0, 0.0, dt);
     mapReadData();
     performDataActions({action::Action::READ_MAPPING_POST}, 0.0, 0.0, 0.0, dt);
@@ -395,16 +408,74 @@ double SolverInterfaceImpl::advance(
 {
 
   PRECICE_TRACE(computedTimestepLength);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+
+  stopSolverEvents();
+
+  Event                    e("advance", precice::syncMode);
+  utils::ScopedEventPrefix sep("advance/");
+
+  prepareAdvance(computedTimestepLength);
+  exchangeAdvance();
+  return finishAdvance();
+}
+
+void SolverInterfaceImpl::startAdvance(
+    double computedTimestepLength)
+{
+  PRECICE_TRACE(computedTimestepLength);
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+
+  stopSolverEvents();
+
+  {
+    Event                    e("startAdvance", precice::syncMode);
+    utils::ScopedEventPrefix sep("startAdvance/");
+    prepareAdvance(computedTimestepLength);
+  }
+
+  auto exchange = [this] {
+    Event                    e("advance", precice::syncMode);
+    utils::ScopedEventPrefix sep("advance/");
+    exchangeAdvance();
+  };
 
+  // The solver must not call preCICE until completeAdvance(), but may still use MPI itself.
+  if (utils::Parallel::allowsBackgroundCommunication()) {
+    _pendingAdvance = std::async(std::launch::async, exchange);
+  } else {
+    PRECICE_DEBUG("MPI does not allow to communicate in a background thread. The data exchange is deferred to completeAdvance().");
+    _pendingAdvance = std::async(std::launch::deferred, exchange);
+  }
+}
+
+double SolverInterfaceImpl::completeAdvance()
+{
+  PRECICE_TRACE();
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_CHECK(_pendingAdvance.valid(), "completeAdvance() can only be called after startAdvance().");
+
+  // Waits for the exchange and rethrows its exceptions
+  _pendingAdvance.get();
+
+  Event                    e("completeAdvance", precice::syncMode);
+  utils::ScopedEventPrefix sep("completeAdvance/");
+  return finishAdvance();
+}
+
+void SolverInterfaceImpl::stopSolverEvents()
+{
   // Events for the solver time, stopped when we enter, restarted when we leave advance
   auto &solverEvent = EventRegistry::instance().getStoredEvent("solver.advance");
   solverEvent.stop(precice::syncMode);
   auto &solverInitEvent = EventRegistry::instance().getStoredEvent("solver.initialize");
   solverInitEvent.stop(precice::syncMode);
+}
 
-  Event                    e("advance", precice::syncMode);
-  utils::ScopedEventPrefix sep("advance/");
-
+void SolverInterfaceImpl::prepareAdvance(
+    double computedTimestepLength)
+{
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before advance().");
   PRECICE_CHECK(_state != State::Finalized, "advance() cannot be called after finalize().")
   PRECICE_ASSERT(_couplingScheme->isInitialized());
@@ -417,7 +488,8 @@ double SolverInterfaceImpl::advance(
 
   // This is the first time advance is called. Initializes the waveform with data from initializeData or 0, if initializeData was not called.
   // @todo: Can be moved to the end of initializeData(), if initializeData() becomes mandatory. See https://github.com/precice/precice/issues/1196.
-  if (_numberAdvanceCalls == 1) {
+  // A restart already restored the waveform of the current time window.
+  if (_numberAdvanceCalls == 1 && not _hasRestarted) {
     for (auto &context : _accessor->readDataContexts()) {
       context.moveToNextWindow();
     }
@@ -430,29 +502,33 @@ double SolverInterfaceImpl::advance(
   }
 #endif
 
-  double timeWindowSize         = 0.0; // Length of (full) current time window
-  double timeWindowComputedPart = 0.0; // Length of computed part of (full) current time window
-  double time                   = 0.0; // Current time
+  auto &times          = _advanceTimes;
+  times.timestepLength = computedTimestepLength;
 
   // Update the coupling scheme time state. Necessary to get correct remainder.
   _couplingScheme->addComputedTime(computedTimestepLength);
 
   if (_couplingScheme->hasTimeWindowSize()) {
-    timeWindowSize         = _couplingScheme->getTimeWindowSize();
-    timeWindowComputedPart = timeWindowSize - _couplingScheme->getThisTimeWindowRemainder();
+    times.timeWindowSize         = _couplingScheme->getTimeWindowSize();
+    times.timeWindowComputedPart = times.timeWindowSize - _couplingScheme->getThisTimeWindowRemainder();
   } else {
     // use time window size provided to advance, only allowed, if this participant sets the time window size for the other participant
-    timeWindowSize         = computedTimestepLength;
-    timeWindowComputedPart = computedTimestepLength;
+    times.timeWindowSize         = computedTimestepLength;
+    times.timeWindowComputedPart = computedTimestepLength;
   }
 
-  time = _couplingScheme->getTime();
+  times.time = _couplingScheme->getTime();
 
   if (_couplingScheme->willDataBeExchanged(0.0)) {
-    performDataActions({action::Action::WRITE_MAPPING_PRIOR}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::WRITE_MAPPING_PRIOR}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
     mapWrittenData();
-    performDataActions({action::Action::WRITE_MAPPING_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::WRITE_MAPPING_POST}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
   }
+}
+
+void SolverInterfaceImpl::exchangeAdvance()
+{
+  const auto &times = _advanceTimes;
 
   PRECICE_DEBUG("Advance coupling scheme");
   _couplingScheme->advance();
@@ -464,13 +540,23 @@ double SolverInterfaceImpl::advance(
   }
 
   if (_couplingScheme->hasDataBeenReceived()) {
-    performDataActions({action::Action::READ_MAPPING_PRIOR}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::READ_MAPPING_PRIOR}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
     mapReadData();
-    performDataActions({action::Action::READ_MAPPING_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::READ_MAPPING_POST}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
   }
+}
+
+double SolverInterfaceImpl::finishAdvance()
+{
+  const auto &times = _advanceTimes;
 
   if (_couplingScheme->isTimeWindowComplete()) {
-    performDataActions({action::Action::ON_TIME_WINDOW_COMPLETE_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::ON_TIME_WINDOW_COMPLETE_POST}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
+
+    const int completedTimeWindows = _couplingScheme->getTimeWindows() - 1;
+    if (_checkpointInterval > 0 && _couplingScheme->isCouplingOngoing() && completedTimeWindows % _checkpointInterval == 0) {
+      writeCheckpoint();
+    }
   }
 
   PRECICE_INFO(_couplingScheme->printCouplingState());
@@ -481,14 +567,65 @@ double SolverInterfaceImpl::advance(
   resetWrittenData();
 
   _meshLock.lockAll();
-  solverEvent.start(precice::syncMode);
+  EventRegistry::instance().getStoredEvent("solver.advance").start(precice::syncMode);
   return _couplingScheme->getNextTimestepMaxLength();
 }
 
+std::string SolverInterfaceImpl::checkpointFile() const
+{
+  return fmt::format("{}/precice-{}-{}.checkpoint", _checkpointDirectory, _accessorName, _accessorProcessRank);
+}
+
+void SolverInterfaceImpl::writeCheckpoint()
+{
+  PRECICE_TRACE();
+  Event e("writeCheckpoint");
+
+  const auto filename = checkpointFile();
+  PRECICE_DEBUG("Write checkpoint to {}", filename);
+  io::CheckpointWriter writer(filename);
+  writer.writeTag("SolverInterface");
+  writer.write(_couplingScheme->getTime());
+  writer.write(_couplingScheme->getTimeWindows());
+  _couplingScheme->exportState(writer);
+  for (const auto &context : _accessor->readDataContexts()) {
+    context.exportState(writer);
+  }
+  writer.close();
+  PRECICE_INFO("Wrote checkpoint of time window {}", _couplingScheme->getTimeWindows() - 1);
+}
+
+void SolverInterfaceImpl::restartFromCheckpoint()
+{
+  PRECICE_TRACE();
+  Event e("restartFromCheckpoint");
+
+  const auto filename = checkpointFile();
+  PRECICE_INFO("Restart from checkpoint {}", filename);
+  io::CheckpointReader reader(filename);
+  reader.readTag("SolverInterface");
+  double time;
+  int    timeWindow;
+  reader.read(time);
+  reader.read(timeWindow);
+
+  PRECICE_DEBUG("Initialize coupling schemes at time {} and time window {}", time, timeWindow);
+  _couplingScheme->initialize(time, timeWindow);
+  PRECICE_ASSERT(_couplingScheme->isInitialized());
+  _couplingScheme->importState(reader);
+
+  for (auto &context : _accessor->readDataContexts()) {
+    context.initializeWaveform();
+    context.importState(reader);
+  }
+  _hasRestarted = true;
+}
+
 void SolverInterfaceImpl::finalize()
 {
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Finalized, "finalize() may only be called once.")
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
 
   // Events for the solver time, finally stopped here
   auto &solverEvent = EventRegistry::instance().getStoredEvent("solver.advance");
@@ -533,7 +670,8 @@ void SolverInterfaceImpl::finalize()
     utils::EventRegistry::instance().printAll();
   }
 
-  // Finally clear events and finalize MPI
+  // Finally stop the threads, clear events, and finalize MPI
+  utils::ThreadPool::instance().configure(1, false);
   utils::EventRegistry::instance().clear();
   utils::Parallel::finalizeManagedMPI();
   _state = State::Finalized;
@@ -548,6 +686,7 @@ int SolverInterfaceImpl::getDimensions() const
 bool SolverInterfaceImpl::isCouplingOngoing() const
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isCouplingOngoing() can be evaluated.");
   PRECICE_CHECK(_state != State::Finalized, "isCouplingOngoing() cannot be called after finalize().");
   return _couplingScheme->isCouplingOngoing();
@@ -556,6 +695,7 @@ bool SolverInterfaceImpl::isCouplingOngoing() const
 bool SolverInterfaceImpl::isReadDataAvailable() const
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isReadDataAvailable().");
   PRECICE_CHECK(_state != State::Finalized, "isReadDataAvailable() cannot be called after finalize().");
   bool available = _couplingScheme->hasDataBeenReceived();
@@ -567,6 +707,7 @@ bool SolverInterfaceImpl::isWriteDataRequired(
     double computedTimestepLength) const
 {
   PRECICE_TRACE(computedTimestepLength);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isWriteDataRequired().");
   PRECICE_CHECK(_state != State::Finalized, "isWriteDataRequired() cannot be called after finalize().");
   return _couplingScheme->willDataBeExchanged(computedTimestepLength);
@@ -575,6 +716,7 @@ bool SolverInterfaceImpl::isWriteDataRequired(
 bool SolverInterfaceImpl::isTimeWindowComplete() const
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isTimeWindowComplete().");
   PRECICE_CHECK(_state != State::Finalized, "isTimeWindowComplete() cannot be called after finalize().");
   return _couplingScheme->isTimeWindowComplete();
@@ -584,6 +726,7 @@ bool SolverInterfaceImpl::isActionRequired(
     const std::string &action) const
 {
   PRECICE_TRACE(action, _couplingScheme->isActionRequired(action));
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isActionRequired(...).");
   PRECICE_CHECK(_state != State::Finalized, "isActionRequired(...) cannot be called after finalize().");
   return _couplingScheme->isActionRequired(action);
@@ -593,6 +736,7 @@ void SolverInterfaceImpl::markActionFulfilled(
     const std::string &action)
 {
   PRECICE_TRACE(action);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before markActionFulfilled(...).");
   PRECICE_CHECK(_state != State::Finalized, "markActionFulfilled(...) cannot be called after finalize().");
   _couplingScheme->markActionFulfilled(action);
@@ -752,6 +896,46 @@ void SolverInterfaceImpl::setMeshVertices(
   mesh->allocateDataValues();
 }
 
+void SolverInterfaceImpl::moveMeshVertices(
+    int           meshID,
+    int           size,
+    const int *   ids,
+    const double *positions)
+{
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_TRACE(meshID, size);
+  PRECICE_REQUIRE_MESH_PROVIDE(meshID);
+  PRECICE_CHECK(_state == State::Initialized, "moveMeshVertices(...) can only be called after initialize(). "
+                                              "Before, please use setMeshVertices(...) to define the final positions.");
+  MeshContext & context = _accessor->usedMeshContext(meshID);
+  mesh::PtrMesh mesh(context.mesh);
+  PRECICE_CHECK(not context.partition->isCommunicated(),
+                "The mesh \"{}\" of participant \"{}\" is received by another participant. "
+                "Only vertices of meshes which are not communicated can be moved.",
+                mesh->getName(), _accessorName);
+  PRECICE_VALIDATE_DATA(positions, size * _dimensions);
+
+  precice::utils::Event e("moveMeshVertices." + mesh->getName());
+  const auto                              vertexCount = mesh->vertices().size();
+  const Eigen::Map<const Eigen::MatrixXd> posMatrix{
+      positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
+  std::vector<VertexID> movedVertices(ids, ids + size);
+  for (int i = 0; i < size; ++i) {
+    PRECICE_CHECK(0 <= ids[i] && static_cast<size_t>(ids[i]) < vertexCount,
+                  "Cannot move vertex with ID {} of mesh \"{}\" as the mesh only has {} vertices.",
+                  ids[i], mesh->getName(), vertexCount);
+    mesh->moveVertex(ids[i], posMatrix.col(i));
+  }
+
+  PRECICE_DEBUG("Update mappings from and to mesh \"{}\"", mesh->getName());
+  for (auto &mappingContext : context.fromMappingContexts) {
+    mappingContext.mapping->updateMapping(*mesh, movedVertices);
+  }
+  for (auto &mappingContext : context.toMappingContexts) {
+    mappingContext.mapping->updateMapping(*mesh, movedVertices);
+  }
+}
+
 void SolverInterfaceImpl::getMeshVertices(
     int        meshID,
     size_t     size,
@@ -1998,16 +2182,65 @@ void SolverInterfaceImpl::clearMappings(utils::ptr_vector<MappingContext> contex
   }
 }
 
+void SolverInterfaceImpl::mapDataContexts(const std::vector<DataContext *> &contexts)
+{
+  PRECICE_TRACE(contexts.size());
+
+  // Group the contexts with rank-local mappings, such that contexts mapping to common data are in the same group
+  std::vector<std::vector<DataContext *>> groups;
+  std::vector<DataContext *>              communicatingContexts;
+  for (DataContext *context : contexts) {
+    // Synchronized events would call barriers concurrently
+    if (precice::syncMode || not context->hasRankLocalMappings()) {
+      communicatingContexts.push_back(context);
+      continue;
+    }
+    std::vector<DataContext *> group;
+    for (auto other = groups.begin(); other != groups.end();) {
+      if (std::any_of(other->begin(), other->end(), [context](const DataContext *member) { return context->sharesMappedDataWith(*member); })) {
+        group.insert(group.end(), other->begin(), other->end());
+        other = groups.erase(other);
+      } else {
+        ++other;
+      }
+    }
+    group.push_back(context);
+    groups.push_back(std::move(group));
+  }
+
+  const auto mapGroup = [this](const std::vector<DataContext *> &group) {
+    for (DataContext *context : group) {
+      PRECICE_DEBUG("Map data \"{}\" of mesh \"{}\"", context->getDataName(), context->getMeshName());
+      context->mapData();
+    }
+  };
+
+  // The calling thread maps the communicating contexts and the first group, all other groups are mapped by the thread pool
+  std::vector<std::future<void>> tasks;
+  for (std::size_t i = 1; i < groups.size(); ++i) {
+    tasks.push_back(utils::ThreadPool::instance().submit([&mapGroup, &group = groups[i]] { mapGroup(group); }));
+  }
+  mapGroup(communicatingContexts);
+  if (not groups.empty()) {
+    mapGroup(groups.front());
+  }
+  // Rethrows exceptions of the tasks
+  for (auto &task : tasks) {
+    task.get();
+  }
+}
+
 void SolverInterfaceImpl::mapWrittenData()
 {
   PRECICE_TRACE();
   computeMappings(_accessor->writeMappingContexts(), "write");
+  std::vector<DataContext *> contexts;
   for (auto &context : _accessor->writeDataContexts()) {
     if (context.isMappingRequired()) {
-      PRECICE_DEBUG("Map write data \"{}\" from mesh \"{}\"", context.getDataName(), context.getMeshName());
-      context.mapData();
+      contexts.push_back(&context);
     }
   }
+  mapDataContexts(contexts);
   clearMappings(_accessor->writeMappingContexts());
 }
 
@@ -2015,11 +2248,14 @@ void SolverInterfaceImpl::mapReadData()
 {
   PRECICE_TRACE();
   computeMappings(_accessor->readMappingContexts(), "read");
+  std::vector<DataContext *> contexts;
   for (auto &context : _accessor->readDataContexts()) {
     if (context.isMappingRequired()) {
-      PRECICE_DEBUG("Map read data \"{}\" to mesh \"{}\"", context.getDataName(), context.getMeshName());
-      context.mapData();
+      contexts.push_back(&context);
     }
+  }
+  mapDataContexts(contexts);
+  for (auto &context : _accessor->readDataContexts()) {
     context.storeDataInWaveform();
   }
   clearMappings(_accessor->readMappingContexts());
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <future>
 #include <map>
 #include <set>
 #include <stddef.h>
@@ -98,6 +99,12 @@ public:
   /// @copydoc SolverInterface::advance
   double advance(double computedTimestepLength);
 
+  /// @copydoc SolverInterface::startAdvance
+  void startAdvance(double computedTimestepLength);
+
+  /// @copydoc SolverInterface::completeAdvance
+  double completeAdvance();
+
   /// @copydoc SolverInterface::finalize
   void finalize();
 
@@ -147,6 +154,13 @@ public:
   /// @copydoc SolverInterface::resetMesh
   void resetMesh(MeshID meshID);
 
+  /// @copydoc SolverInterface::moveMeshVertices
+  void moveMeshVertices(
+      int           meshID,
+      int           size,
+      const int *   ids,
+      const double *positions);
+
   /// @copydoc SolverInterface::hasMesh
   bool hasMesh(const std::string &meshName) const;
 
@@ -470,6 +484,31 @@ private:
   /// Counts calls to advance for plotting.
   long int _numberAdvanceCalls = 0;
 
+  /// Number of time windows between two checkpoints of the coupling state, 0 disables checkpoints
+  int _checkpointInterval = 0;
+
+  /// Directory of the checkpoints
+  std::string _checkpointDirectory;
+
+  /// Restart from a checkpoint in initialize()
+  bool _restartFromCheckpoint = false;
+
+  /// Was the coupling state restored from a checkpoint?
+  bool _hasRestarted = false;
+
+  /// Time state of the current advance, which is shared by its phases
+  struct AdvanceTimes {
+    double time                   = 0.0; // Current time
+    double timestepLength         = 0.0; // Length of the computed timestep
+    double timeWindowComputedPart = 0.0; // Length of computed part of (full) current time window
+    double timeWindowSize         = 0.0; // Length of (full) current time window
+  };
+
+  AdvanceTimes _advanceTimes;
+
+  /// Exchange of a started, but not yet completed advance
+  std::future<void> _pendingAdvance;
+
   /**
    * @brief Configures the coupling interface from the given xml file.
    *
@@ -520,6 +559,15 @@ private:
   /// Exports meshes with data and watch point data.
   void handleExports();
 
+  /// Returns the checkpoint file of this rank
+  std::string checkpointFile() const;
+
+  /// Writes the coupling state and the read waveforms to the checkpoint file of this rank
+  void writeCheckpoint();
+
+  /// Restores the state written by writeCheckpoint() and reinitializes the coupling scheme at the time of the checkpoint
+  void restartFromCheckpoint();
+
   /// Determines participants providing meshes to other participants.
   void configurePartitions(
       const m2n::M2NConfiguration::SharedPointer &m2nConfig);
@@ -536,6 +584,15 @@ private:
   /// Helper for mapWrittenData and mapReadData
   void clearMappings(utils::ptr_vector<MappingContext> contexts);
 
+  /**
+   * @brief Maps the data of the given contexts.
+   *
+   * Contexts with rank-local mappings are mapped concurrently by the thread pool, see mapping::Mapping::isRankLocal().
+   * Contexts mapping to common data are mapped one after another in the given order.
+   * All other contexts are mapped by the calling thread in the given order, as their mappings may communicate.
+   */
+  void mapDataContexts(const std::vector<DataContext *> &contexts);
+
   /// Computes, performs, and resets all suitable write mappings.
   void mapWrittenData();
 
@@ -561,6 +618,18 @@ private:
   /// Resets written data, displacements and mesh neighbors to export.
   void resetWrittenData();
 
+  /// Stops the events measuring the time spent in the solver.
+  void stopSolverEvents();
+
+  /// First phase of advance: Updates the time state and maps written data.
+  void prepareAdvance(double computedTimestepLength);
+
+  /// Second phase of advance: Advances the coupling scheme and maps read data.
+  void exchangeAdvance();
+
+  /// Last phase of advance: Handles actions and exports, returns the maximum length of the next timestep.
+  double finishAdvance();
+
   /// Determines participant accessing this interface from the configuration.
   impl::PtrParticipant determineAccessingParticipant(
       const config::SolverInterfaceConfiguration &config);
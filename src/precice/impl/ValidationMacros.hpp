@@ -89,6 +89,17 @@
     PRECICE_REQUIRE_MESH_MODIFY_IMPL(id)    \
   } while (false)
 
+//
+// STATE VALIDATION
+//
+
+/// Checks that there is no advance started by startAdvance() waiting for completeAdvance()
+#define PRECICE_REQUIRE_NO_PENDING_ADVANCE()                                                                  \
+  PRECICE_CHECK(!_pendingAdvance.valid(),                                                                     \
+                "You called the API function \"{}\" after startAdvance(). "                                   \
+                "Please call completeAdvance() first, as preCICE may still exchange data in the background.", \
+                __func__)
+
 //
 // DATA VALIDATION
 //
@@ -98,6 +109,7 @@
  * @attention Do not use this macro directly!
  */
 #define PRECICE_VALIDATE_DATA_ID_IMPL(id) \
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE()    \
   PRECICE_CHECK(_accessor->hasData(id),   \
                 "The given Data ID \"{}\" is unknown to preCICE.", id);
 
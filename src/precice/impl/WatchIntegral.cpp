@@ -65,44 +65,45 @@ void WatchIntegral::exportIntegralData(
     _txtWriter.writeData("Time", time);
   }
 
-  for (auto &elem : _dataToExport) {
-    const int dataDimensions = elem->getDimensions();
-    auto      integral       = calculateIntegral(elem);
+  // Gather all integrals and the surface area to reduce them at once
+  int size = 1;
+  for (const auto &elem : _dataToExport) {
+    size += elem->getDimensions();
+  }
+  Eigen::VectorXd values(size);
+  int             offset = 0;
+  for (const auto &elem : _dataToExport) {
+    const int dataDimensions               = elem->getDimensions();
+    values.segment(offset, dataDimensions) = calculateIntegral(elem);
+    offset += dataDimensions;
+  }
+  // Calculate surface area only if there is connectivity information
+  values[offset] = _mesh->edges().empty() ? 0.0 : _mesh->getArea();
 
-    if (utils::IntraComm::getSize() > 1) {
-      Eigen::VectorXd valueRecv = Eigen::VectorXd::Zero(dataDimensions);
-      utils::IntraComm::reduceSum(integral, valueRecv);
-      integral = std::move(valueRecv);
-    }
-    if (not utils::IntraComm::isSecondary()) {
-      if (dataDimensions == 1) {
-        _txtWriter.writeData(elem->getName(), integral[0]);
-      } else if (dataDimensions == 2) {
-        _txtWriter.writeData(elem->getName(), Eigen::Vector2d(integral));
-      } else {
-        _txtWriter.writeData(elem->getName(), Eigen::Vector3d(integral));
-      }
-    }
+  // Empty partitions have to take part in the reduction as well to prevent a deadlock
+  if (utils::IntraComm::getSize() > 1) {
+    Eigen::VectorXd valuesRecv = Eigen::VectorXd::Zero(size);
+    utils::IntraComm::reduceSum(values, valuesRecv);
+    values = std::move(valuesRecv);
+  }
+  if (utils::IntraComm::isSecondary()) {
+    return;
   }
 
-  // Calculate surface area only if there is connectivity information
-  if (not _mesh->edges().empty()) {
-    double surfaceArea = calculateSurfaceArea();
-    if (utils::IntraComm::getSize() > 1) {
-      double surfaceAreaSum = 0.0;
-      utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
-      surfaceArea = surfaceAreaSum;
-    }
-    if (not utils::IntraComm::isSecondary()) {
-      _txtWriter.writeData("SurfaceArea", surfaceArea);
-    }
-  } else {
-    // Empty partitions should also call reduceSum to prevent deadlock
-    if (utils::IntraComm::getSize() > 1) {
-      double surfaceArea    = 0.0;
-      double surfaceAreaSum = 0.0;
-      utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
+  offset = 0;
+  for (const auto &elem : _dataToExport) {
+    const int dataDimensions = elem->getDimensions();
+    if (dataDimensions == 1) {
+      _txtWriter.writeData(elem->getName(), values[offset]);
+    } else if (dataDimensions == 2) {
+      _txtWriter.writeData(elem->getName(), Eigen::Vector2d(values.segment<2>(offset)));
+    } else {
+      _txtWriter.writeData(elem->getName(), Eigen::Vector3d(values.segment<3>(offset)));
     }
+    offset += dataDimensions;
+  }
+  if (not _mesh->edges().empty()) {
+    _txtWriter.writeData("SurfaceArea", values[offset]);
   }
 }
 
@@ -125,20 +126,4 @@ Eigen::VectorXd WatchIntegral::calculateIntegral(const mesh::PtrData &data) cons
   }
 }
 
-double WatchIntegral::calculateSurfaceArea() const
-{
-  PRECICE_ASSERT(not _mesh->edges().empty());
-  double surfaceArea = 0.0;
-  if (_mesh->getDimensions() == 3) {
-    for (const auto &face : _mesh->triangles()) {
-      surfaceArea += face.getArea();
-    }
-  } else {
-    for (const auto &edge : _mesh->edges()) {
-      surfaceArea += edge.getLength();
-    }
-  }
-  return surfaceArea;
-}
-
 } // namespace precice::impl
@@ -56,8 +56,6 @@ private:
   bool _isScalingOn;
 
   Eigen::VectorXd calculateIntegral(const mesh::PtrData &data) const;
-
-  double calculateSurfaceArea() const;
 };
 
 } // namespace impl
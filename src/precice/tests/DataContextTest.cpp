@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <string>
+#include "mapping/NearestNeighborMapping.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
@@ -227,5 +228,50 @@ BOOST_AUTO_TEST_CASE(testDataContextReadMapping)
   BOOST_TEST(fixture.mappingContexts(dataContext)[0].timing == mappingContext.timing);
 }
 
+BOOST_AUTO_TEST_CASE(testDataContextMappingDependencies)
+{
+  PRECICE_TEST(1_rank);
+
+  // Meshes A and C write to mesh B
+  int           dimensions = 2;
+  mesh::PtrMesh ptrMeshA   = std::make_shared<mesh::Mesh>("MeshA", dimensions, testing::nextMeshID());
+  mesh::PtrData forcesA    = ptrMeshA->createData("Forces", dimensions, 0_dataID);
+  mesh::PtrData heatA      = ptrMeshA->createData("Heat", 1, 1_dataID);
+  mesh::PtrMesh ptrMeshB   = std::make_shared<mesh::Mesh>("MeshB", dimensions, testing::nextMeshID());
+  ptrMeshB->createData("Forces", dimensions, 2_dataID);
+  ptrMeshB->createData("Heat", 1, 3_dataID);
+  mesh::PtrMesh ptrMeshC = std::make_shared<mesh::Mesh>("MeshC", dimensions, testing::nextMeshID());
+  mesh::PtrData forcesC  = ptrMeshC->createData("Forces", dimensions, 4_dataID);
+
+  MeshContext meshContextB(dimensions);
+  meshContextB.mesh = ptrMeshB;
+
+  MappingContext mappingContextAB;
+  mappingContextAB.fromMeshID = ptrMeshA->getID();
+  mappingContextAB.toMeshID   = ptrMeshB->getID();
+  mappingContextAB.mapping    = std::make_shared<mapping::NearestNeighborMapping>(mapping::Mapping::CONSERVATIVE, dimensions);
+
+  MappingContext mappingContextCB;
+  mappingContextCB.fromMeshID = ptrMeshC->getID();
+  mappingContextCB.toMeshID   = ptrMeshB->getID();
+  mappingContextCB.mapping    = std::make_shared<mapping::NearestNeighborMapping>(mapping::Mapping::CONSERVATIVE, dimensions);
+
+  WriteDataContext forcesContextA(forcesA, ptrMeshA);
+  forcesContextA.appendMappingConfiguration(mappingContextAB, meshContextB);
+  WriteDataContext heatContextA(heatA, ptrMeshA);
+  heatContextA.appendMappingConfiguration(mappingContextAB, meshContextB);
+  WriteDataContext forcesContextC(forcesC, ptrMeshC);
+  forcesContextC.appendMappingConfiguration(mappingContextCB, meshContextB);
+
+  BOOST_TEST(forcesContextA.hasRankLocalMappings());
+  BOOST_TEST(heatContextA.hasRankLocalMappings());
+
+  // Both forces are mapped to the forces of mesh B, which requires to map them one after another
+  BOOST_TEST(forcesContextA.sharesMappedDataWith(forcesContextC));
+  BOOST_TEST(forcesContextC.sharesMappedDataWith(forcesContextA));
+  BOOST_TEST(!forcesContextA.sharesMappedDataWith(heatContextA));
+  BOOST_TEST(!heatContextA.sharesMappedDataWith(forcesContextC));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -787,7 +787,7 @@ BOOST_AUTO_TEST_CASE(MeshChangeFaceConnectivity)
     watchIntegral.exportIntegralData(0.0);
 
     // Change data (next timestep)
-    v2.setCoords(Eigen::Vector3d(3.0, -4.0, 0.0));
+    mesh->moveVertex(v2.getID(), Eigen::Vector3d(3.0, -4.0, 0.0));
 
     // Write output again
     watchIntegral.exportIntegralData(1.0);
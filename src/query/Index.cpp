@@ -2,13 +2,16 @@
 #include <algorithm>
 #include <boost/iterator/function_output_iterator.hpp>
 #include <boost/range/irange.hpp>
+#include <tuple>
 #include <utility>
 
 #include "logging/LogMacros.hpp"
 #include "precice/types.hpp"
 #include "query/Index.hpp"
+#include "query/impl/KDTree.hpp"
 #include "query/impl/RTreeAdapter.hpp"
 #include "utils/Event.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -25,6 +28,8 @@ using TriangleTraits    = impl::RTreeTraits<mesh::Triangle>;
 using TetrahedronTraits = impl::RTreeTraits<mesh::Tetrahedron>;
 
 struct MeshIndices {
+  std::shared_ptr<impl::KDTree<2>> vertexKDTree2D;
+  std::shared_ptr<impl::KDTree<3>> vertexKDTree3D;
   VertexTraits::Ptr      vertexRTree;
   EdgeTraits::Ptr        edgeRTree;
   TriangleTraits::Ptr    triangleRTree;
@@ -33,17 +38,50 @@ struct MeshIndices {
 
 class Index::IndexImpl {
 public:
+  template <int Dim>
+  const impl::KDTree<Dim> &getVertexKDTree(const mesh::Mesh &mesh);
+
   VertexTraits::Ptr      getVertexRTree(const mesh::Mesh &mesh);
   EdgeTraits::Ptr        getEdgeRTree(const mesh::Mesh &mesh);
   TriangleTraits::Ptr    getTriangleRTree(const mesh::Mesh &mesh);
   TetrahedronTraits::Ptr getTetraRTree(const mesh::Mesh &mesh);
 
+  void insertVertex(VertexID id);
+  void removeVertex(VertexID id);
+
   void clear();
 
+  /// Returns true if vertex queries use the R-tree, as the k-d tree cannot be updated
+  bool usesVertexRTree() const
+  {
+    return updatesVertices;
+  }
+
 private:
   MeshIndices indices;
+
+  /// Set once the vertices of an indexed mesh changed
+  bool updatesVertices = false;
 };
 
+template <int Dim>
+const impl::KDTree<Dim> &Index::IndexImpl::getVertexKDTree(const mesh::Mesh &mesh)
+{
+  auto &tree = [this]() -> std::shared_ptr<impl::KDTree<Dim>> & {
+    if constexpr (Dim == 2) {
+      return indices.vertexKDTree2D;
+    } else {
+      return indices.vertexKDTree3D;
+    }
+  }();
+
+  if (!tree) {
+    precice::utils::Event e("query.index.getVertexIndexTree." + mesh.getName());
+    tree = std::make_shared<impl::KDTree<Dim>>(mesh.vertices());
+  }
+  return *tree;
+}
+
 VertexTraits::Ptr Index::IndexImpl::getVertexRTree(const mesh::Mesh &mesh)
 {
   if (indices.vertexRTree) {
@@ -143,8 +181,41 @@ TetrahedronTraits::Ptr Index::IndexImpl::getTetraRTree(const mesh::Mesh &mesh)
   return indices.tetraRTree;
 }
 
+void Index::IndexImpl::insertVertex(VertexID id)
+{
+  if (indices.vertexKDTree2D || indices.vertexKDTree3D) {
+    // Switch to the R-tree, which is built on demand
+    updatesVertices = true;
+    indices.vertexKDTree2D.reset();
+    indices.vertexKDTree3D.reset();
+  }
+  if (indices.vertexRTree) {
+    indices.vertexRTree->insert(static_cast<VertexTraits::IndexType>(id));
+  }
+}
+
+void Index::IndexImpl::removeVertex(VertexID id)
+{
+  if (indices.vertexKDTree2D || indices.vertexKDTree3D) {
+    // Switch to the R-tree, which is built on demand
+    updatesVertices = true;
+    indices.vertexKDTree2D.reset();
+    indices.vertexKDTree3D.reset();
+  }
+  if (indices.vertexRTree) {
+    const auto removed = indices.vertexRTree->remove(static_cast<VertexTraits::IndexType>(id));
+    PRECICE_ASSERT(removed == 1, "The vertex was not found in the index. Was it moved before removing it?", id);
+    std::ignore = removed;
+  }
+  indices.edgeRTree.reset();
+  indices.triangleRTree.reset();
+  indices.tetraRTree.reset();
+}
+
 void Index::IndexImpl::clear()
 {
+  indices.vertexKDTree2D.reset();
+  indices.vertexKDTree3D.reset();
   indices.vertexRTree.reset();
   indices.edgeRTree.reset();
   indices.triangleRTree.reset();
@@ -175,6 +246,13 @@ VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
   PRECICE_TRACE();
 
   PRECICE_ASSERT(not _mesh->vertices().empty(), _mesh->getName());
+  if (not _pimpl->usesVertexRTree()) {
+    if (_mesh->getDimensions() == 2) {
+      return VertexMatch(_pimpl->getVertexKDTree<2>(*_mesh).nearest(sourceCoord));
+    }
+    return VertexMatch(_pimpl->getVertexKDTree<3>(*_mesh).nearest(sourceCoord));
+  }
+
   VertexMatch match;
   const auto &rtree = _pimpl->getVertexRTree(*_mesh);
   rtree->query(bgi::nearest(sourceCoord, 1), boost::make_function_output_iterator([&](size_t matchID) {
@@ -183,6 +261,25 @@ VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
   return match;
 }
 
+std::vector<VertexMatch> Index::getClosestVertices(const std::deque<mesh::Vertex> &sourceVertices)
+{
+  PRECICE_TRACE(sourceVertices.size());
+
+  std::vector<VertexMatch> matches(sourceVertices.size());
+  if (sourceVertices.empty()) {
+    return matches;
+  }
+
+  // The first query builds the tree, which is only read by the concurrent queries
+  matches.front() = getClosestVertex(sourceVertices.front().getCoords());
+  utils::parallelFor(1, sourceVertices.size(), 256, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      matches[i] = getClosestVertex(sourceVertices[i].getCoords());
+    }
+  });
+  return matches;
+}
+
 std::vector<EdgeMatch> Index::getClosestEdges(const Eigen::VectorXd &sourceCoord, int n)
 {
   PRECICE_TRACE();
@@ -213,8 +310,17 @@ std::vector<VertexID> Index::getVerticesInsideBox(const mesh::Vertex &centerVert
 {
   PRECICE_TRACE();
 
+  auto coords = centerVertex.getCoords();
+  if (not _pimpl->usesVertexRTree()) {
+    Eigen::VectorXd       min     = coords.array() - radius;
+    Eigen::VectorXd       max     = coords.array() + radius;
+    std::vector<VertexID> matches = verticesInsideBox(min, max);
+    matches.erase(std::remove_if(matches.begin(), matches.end(), [&](VertexID i) { return bg::distance(centerVertex, _mesh->vertices()[i]) > radius; }),
+                  matches.end());
+    return matches;
+  }
+
   // Prepare boost::geometry box
-  auto coords    = centerVertex.getCoords();
   auto searchBox = query::makeBox(coords.array() - radius, coords.array() + radius);
 
   const auto &          rtree = _pimpl->getVertexRTree(*_mesh);
@@ -227,6 +333,10 @@ std::vector<VertexID> Index::getVerticesInsideBox(const mesh::Vertex &centerVert
 std::vector<VertexID> Index::getVerticesInsideBox(const mesh::BoundingBox &bb)
 {
   PRECICE_TRACE();
+  if (not _pimpl->usesVertexRTree()) {
+    return verticesInsideBox(bb.minCorner(), bb.maxCorner());
+  }
+
   // Add tree to the local cache
   const auto &          rtree = _pimpl->getVertexRTree(*_mesh);
   std::vector<VertexID> matches;
@@ -246,6 +356,19 @@ std::vector<TetrahedronID> Index::getEnclosingTetrahedra(const Eigen::VectorXd &
   return matches;
 }
 
+std::vector<VertexID> Index::verticesInsideBox(const Eigen::VectorXd &min, const Eigen::VectorXd &max)
+{
+  std::vector<VertexID> matches;
+  if (_mesh->getDimensions() == 2) {
+    _pimpl->getVertexKDTree<2>(*_mesh).insideBox(min, max, matches);
+  } else {
+    _pimpl->getVertexKDTree<3>(*_mesh).insideBox(min, max, matches);
+  }
+  // The order of the k-d tree is not meaningful, hence return the vertices in ascending order
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
 ProjectionMatch Index::findNearestProjection(const Eigen::VectorXd &location, int n)
 {
   if (_mesh->getDimensions() == 2) {
@@ -328,6 +451,20 @@ ProjectionMatch Index::findTriangleProjection(const Eigen::VectorXd &location, i
   return findEdgeProjection(location, n);
 }
 
+void Index::insertVertex(VertexID id)
+{
+  PRECICE_TRACE(id);
+  PRECICE_ASSERT(id >= 0 && static_cast<size_t>(id) < _mesh->vertices().size(), id, _mesh->vertices().size());
+  _pimpl->insertVertex(id);
+}
+
+void Index::removeVertex(VertexID id)
+{
+  PRECICE_TRACE(id);
+  PRECICE_ASSERT(id >= 0 && static_cast<size_t>(id) < _mesh->vertices().size(), id, _mesh->vertices().size());
+  _pimpl->removeVertex(id);
+}
+
 void Index::clear()
 {
   _pimpl->clear();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -61,7 +62,13 @@ struct ProjectionMatch {
   };
 };
 
-/// Class to query the index trees of the mesh
+/**
+ * @brief Class to query the index trees of the mesh
+ *
+ * Vertex queries use a k-d tree specialized for the dimension of the mesh, which is built on demand.
+ * Once vertices of the indexed mesh are added or moved, vertex queries switch to an R-tree,
+ * which can be updated incrementally. Edges, triangles, and tetrahedra are indexed by R-trees.
+ */
 class Index {
 
 public:
@@ -72,6 +79,9 @@ public:
   /// Get n number of closest vertices to the given vertex
   VertexMatch getClosestVertex(const Eigen::VectorXd &sourceCoord);
 
+  /// Get the closest vertex to each of the given vertices, queried concurrently by the thread pool
+  std::vector<VertexMatch> getClosestVertices(const std::deque<mesh::Vertex> &sourceVertices);
+
   /// Get n number of closest edges to the given vertex
   std::vector<EdgeMatch> getClosestEdges(const Eigen::VectorXd &sourceCoord, int n);
 
@@ -100,6 +110,24 @@ public:
   ProjectionMatch findNearestProjection(const Eigen::VectorXd &location, int n);
 
   ProjectionMatch findCellOrProjection(const Eigen::VectorXd &location, int n);
+
+  /**
+   * @brief Inserts a vertex into an existing vertex index.
+   *
+   * Use this after adding or moving a vertex to update the index incrementally.
+   * Does nothing if the vertex index has not been built yet.
+   */
+  void insertVertex(VertexID id);
+
+  /**
+   * @brief Removes a vertex from an existing vertex index.
+   *
+   * This has to be called before the vertex changes its coordinates.
+   * As the indices of edges, triangles, and tetrahedra depend on the coordinates of their vertices,
+   * they are dropped and rebuilt on demand.
+   */
+  void removeVertex(VertexID id);
+
   /// Clear the index
   void clear();
 
@@ -112,6 +140,9 @@ private:
 
   static precice::logging::Logger _log;
 
+  /// Returns the vertices inside the axis-aligned box [min, max] using the k-d tree
+  std::vector<VertexID> verticesInsideBox(const Eigen::VectorXd &min, const Eigen::VectorXd &max);
+
   /// Closest vertex projection element is always the nearest neighbor
   ProjectionMatch findVertexProjection(const Eigen::VectorXd &location);
 
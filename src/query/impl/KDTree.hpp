@@ -0,0 +1,186 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "mesh/Mesh.hpp"
+#include "precice/types.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace query {
+namespace impl {
+
+/**
+ * @brief Static k-d tree over the vertices of a mesh, specialized for the dimension of the mesh.
+ *
+ * The tree stores a contiguous copy of the vertex coordinates and is implicit:
+ * The coordinates are ordered such that every range [begin, end) is split at its median position,
+ * the median point belonging to the node. The split dimension, which is the dimension of the
+ * largest extent of the range, is stored at the median position. Ranges of up to LeafSize points
+ * are searched linearly.
+ *
+ * The tree cannot be updated. Ties are resolved in favor of the smaller vertex ID.
+ */
+template <int Dim>
+class KDTree {
+public:
+  static_assert(Dim == 2 || Dim == 3, "The k-d tree supports 2D and 3D meshes only.");
+
+  using Point = Eigen::Matrix<double, Dim, 1>;
+
+  /// Ranges up to this size are searched linearly
+  static constexpr int LeafSize = 8;
+
+  explicit KDTree(const mesh::Mesh::VertexContainer &vertices)
+      : _coords(Dim, vertices.size()),
+        _ids(vertices.size()),
+        _splitDims(vertices.size(), 0)
+  {
+    std::iota(_ids.begin(), _ids.end(), 0);
+    std::vector<Point> points(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+      PRECICE_ASSERT(vertices[i].getDimensions() == Dim, vertices[i].getDimensions(), Dim);
+      points[i] = vertices[i].getCoords();
+    }
+    build(points, 0, _ids.size());
+    for (std::size_t i = 0; i < _ids.size(); ++i) {
+      _coords.col(i) = points[_ids[i]];
+    }
+  }
+
+  std::size_t size() const
+  {
+    return _ids.size();
+  }
+
+  /// Returns the ID of the vertex closest to the given location
+  VertexID nearest(const Point &location) const
+  {
+    PRECICE_ASSERT(size() > 0);
+    Match best;
+    nearest(location, 0, size(), best);
+    return best.id;
+  }
+
+  /// Appends the IDs of all vertices within the axis-aligned box [min, max] to the given vector
+  void insideBox(const Point &min, const Point &max, std::vector<VertexID> &matches) const
+  {
+    insideBox(min, max, 0, size(), matches);
+  }
+
+private:
+  struct Match {
+    double   distance = std::numeric_limits<double>::max();
+    VertexID id       = -1;
+  };
+
+  /// Coordinates ordered as the tree, one point per column
+  Eigen::Matrix<double, Dim, Eigen::Dynamic> _coords;
+
+  /// Vertex IDs ordered as the tree
+  std::vector<VertexID> _ids;
+
+  /// Split dimension of the node at the median position of its range
+  std::vector<std::uint8_t> _splitDims;
+
+  void build(const std::vector<Point> &points, std::size_t begin, std::size_t end)
+  {
+    if (end - begin <= static_cast<std::size_t>(LeafSize)) {
+      return;
+    }
+
+    Point min = points[_ids[begin]];
+    Point max = min;
+    for (auto i = begin + 1; i < end; ++i) {
+      min = min.cwiseMin(points[_ids[i]]);
+      max = max.cwiseMax(points[_ids[i]]);
+    }
+    int dim;
+    (max - min).maxCoeff(&dim);
+
+    const auto mid = begin + (end - begin) / 2;
+    std::nth_element(_ids.begin() + begin, _ids.begin() + mid, _ids.begin() + end,
+                     [&points, dim](VertexID lhs, VertexID rhs) { return points[lhs][dim] < points[rhs][dim]; });
+    _splitDims[mid] = static_cast<std::uint8_t>(dim);
+
+    build(points, begin, mid);
+    build(points, mid + 1, end);
+  }
+
+  void check(const Point &location, std::size_t i, Match &best) const
+  {
+    const double distance = (_coords.col(i) - location).squaredNorm();
+    // The first check always matches, which handles non-finite coordinates
+    if (best.id < 0 || distance < best.distance || (distance == best.distance && _ids[i] < best.id)) {
+      best.distance = distance;
+      best.id       = _ids[i];
+    }
+  }
+
+  void nearest(const Point &location, std::size_t begin, std::size_t end, Match &best) const
+  {
+    if (end - begin <= static_cast<std::size_t>(LeafSize)) {
+      for (auto i = begin; i < end; ++i) {
+        check(location, i, best);
+      }
+      return;
+    }
+
+    const auto   mid  = begin + (end - begin) / 2;
+    const int    dim  = _splitDims[mid];
+    const double diff = location[dim] - _coords(dim, mid);
+    check(location, mid, best);
+
+    // Descend into the half containing the location first
+    if (diff < 0) {
+      nearest(location, begin, mid, best);
+      if (diff * diff <= best.distance) {
+        nearest(location, mid + 1, end, best);
+      }
+    } else {
+      nearest(location, mid + 1, end, best);
+      if (diff * diff <= best.distance) {
+        nearest(location, begin, mid, best);
+      }
+    }
+  }
+
+  bool isInside(const Point &min, const Point &max, std::size_t i) const
+  {
+    return (_coords.col(i).array() >= min.array()).all() && (_coords.col(i).array() <= max.array()).all();
+  }
+
+  void insideBox(const Point &min, const Point &max, std::size_t begin, std::size_t end, std::vector<VertexID> &matches) const
+  {
+    if (end - begin <= static_cast<std::size_t>(LeafSize)) {
+      for (auto i = begin; i < end; ++i) {
+        if (isInside(min, max, i)) {
+          matches.push_back(_ids[i]);
+        }
+      }
+      return;
+    }
+
+    const auto   mid   = begin + (end - begin) / 2;
+    const int    dim   = _splitDims[mid];
+    const double split = _coords(dim, mid);
+    if (isInside(min, max, mid)) {
+      matches.push_back(_ids[mid]);
+    }
+    if (min[dim] <= split) {
+      insideBox(min, max, begin, mid, matches);
+    }
+    if (max[dim] >= split) {
+      insideBox(min, max, mid + 1, end, matches);
+    }
+  }
+};
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -0,0 +1,129 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/impl/KDTree.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::query;
+
+namespace {
+
+/// Creates a mesh of random vertices in the unit cube, including duplicates
+PtrMesh randomMesh(int dimensions, int size)
+{
+  PtrMesh mesh(new Mesh("MyMesh", dimensions, testing::nextMeshID()));
+  std::srand(42);
+  for (int i = 0; i < size; ++i) {
+    mesh->createVertex(Eigen::VectorXd::Random(dimensions));
+  }
+  for (int i = 0; i < 10; ++i) {
+    mesh->createVertex(mesh->vertices()[i].getCoords());
+  }
+  return mesh;
+}
+
+template <int Dim>
+void checkNearest(const Mesh &mesh)
+{
+  impl::KDTree<Dim> tree(mesh.vertices());
+  BOOST_TEST(tree.size() == mesh.vertices().size());
+
+  for (int q = 0; q < 100; ++q) {
+    Eigen::VectorXd location = 1.2 * Eigen::VectorXd::Random(Dim);
+
+    VertexID expected = -1;
+    double   distance = std::numeric_limits<double>::max();
+    for (const auto &v : mesh.vertices()) {
+      const double d = (v.getCoords() - location).squaredNorm();
+      if (d < distance) {
+        distance = d;
+        expected = v.getID();
+      }
+    }
+    BOOST_TEST(tree.nearest(location) == expected);
+  }
+
+  // Ties are resolved in favor of the smaller ID
+  BOOST_TEST(tree.nearest(mesh.vertices()[3].getCoords()) == 3);
+}
+
+template <int Dim>
+void checkInsideBox(const Mesh &mesh)
+{
+  impl::KDTree<Dim> tree(mesh.vertices());
+
+  for (int q = 0; q < 100; ++q) {
+    Eigen::VectorXd center = Eigen::VectorXd::Random(Dim);
+    Eigen::VectorXd min    = center.array() - 0.3;
+    Eigen::VectorXd max    = center.array() + 0.2;
+
+    std::vector<VertexID> expected;
+    for (const auto &v : mesh.vertices()) {
+      if ((v.getCoords().array() >= min.array()).all() && (v.getCoords().array() <= max.array()).all()) {
+        expected.push_back(v.getID());
+      }
+    }
+
+    std::vector<VertexID> matches;
+    tree.insideBox(min, max, matches);
+    std::sort(matches.begin(), matches.end());
+    BOOST_TEST(matches == expected, boost::test_tools::per_element());
+  }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(QueryTests)
+BOOST_AUTO_TEST_SUITE(KDTreeTests)
+
+BOOST_AUTO_TEST_CASE(Nearest2D)
+{
+  PRECICE_TEST(1_rank);
+  checkNearest<2>(*randomMesh(2, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(Nearest3D)
+{
+  PRECICE_TEST(1_rank);
+  checkNearest<3>(*randomMesh(3, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(InsideBox2D)
+{
+  PRECICE_TEST(1_rank);
+  checkInsideBox<2>(*randomMesh(2, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(InsideBox3D)
+{
+  PRECICE_TEST(1_rank);
+  checkInsideBox<3>(*randomMesh(3, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(SmallAndEmpty)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("MyMesh", 2, testing::nextMeshID());
+  {
+    impl::KDTree<2>       tree(mesh.vertices());
+    std::vector<VertexID> matches;
+    tree.insideBox(Eigen::Vector2d(-1, -1), Eigen::Vector2d(1, 1), matches);
+    BOOST_TEST(tree.size() == 0);
+    BOOST_TEST(matches.empty());
+  }
+  mesh.createVertex(Eigen::Vector2d(0, 0));
+  mesh.createVertex(Eigen::Vector2d(1, 0));
+  impl::KDTree<2> tree(mesh.vertices());
+  BOOST_TEST(tree.nearest(Eigen::Vector2d(0.8, 0.5)) == 1);
+  BOOST_TEST(tree.nearest(Eigen::Vector2d(0.5, 0.5)) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // KDTreeTests
+BOOST_AUTO_TEST_SUITE_END() // QueryTests
@@ -191,6 +191,39 @@ BOOST_AUTO_TEST_CASE(QueryWithBoxEverything)
   BOOST_TEST(results.size() == 8);
 }
 
+BOOST_AUTO_TEST_CASE(MoveVertexUpdatesIndex)
+{
+  PRECICE_TEST(1_rank);
+  auto  mesh  = edgeMesh3D();
+  auto &index = mesh->index();
+
+  Eigen::Vector3d location(0.8, 0.0, 0.8);
+  BOOST_TEST(mesh->vertices().at(index.getClosestVertex(location).index).getCoords() == Eigen::Vector3d(1, 0, 1));
+
+  // Move vertex (0, 0, 0) close to the location
+  mesh->moveVertex(0, Eigen::Vector3d(0.8, 0.1, 0.8));
+  BOOST_TEST(index.getClosestVertex(location).index == 0);
+
+  // Move it away again
+  mesh->moveVertex(0, Eigen::Vector3d(-1, -1, -1));
+  BOOST_TEST(mesh->vertices().at(index.getClosestVertex(location).index).getCoords() == Eigen::Vector3d(1, 0, 1));
+  BOOST_TEST(index.getClosestVertex(Eigen::Vector3d(-2, -2, -2)).index == 0);
+}
+
+BOOST_AUTO_TEST_CASE(CreateVertexUpdatesIndex)
+{
+  PRECICE_TEST(1_rank);
+  auto  mesh  = edgeMesh3D();
+  auto &index = mesh->index();
+
+  Eigen::Vector3d location(0.5, 0.5, 0.5);
+  BOOST_TEST(index.getVerticesInsideBox(mesh::Vertex(location, 0), 0.1).empty());
+
+  const auto id = mesh->createVertex(location).getID();
+  BOOST_TEST(index.getClosestVertex(location).index == id);
+  BOOST_TEST(index.getVerticesInsideBox(mesh::Vertex(location, 0), 0.1) == std::vector<VertexID>{id});
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Vertex
 
 BOOST_AUTO_TEST_SUITE(Edge)
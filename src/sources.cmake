@@ -78,6 +78,10 @@ target_sources(precice
     src/com/MPISinglePortsCommunication.hpp
     src/com/MPISinglePortsCommunicationFactory.cpp
     src/com/MPISinglePortsCommunicationFactory.hpp
+    src/com/PayloadCodec.cpp
+    src/com/PayloadCodec.hpp
+    src/com/ProgressEngine.cpp
+    src/com/ProgressEngine.hpp
     src/com/Request.cpp
     src/com/Request.hpp
     src/com/SharedPointer.hpp
@@ -124,6 +128,10 @@ target_sources(precice
     src/cplscheme/impl/ResidualRelativeConvergenceMeasure.cpp
     src/cplscheme/impl/ResidualRelativeConvergenceMeasure.hpp
     src/cplscheme/impl/SharedPointer.hpp
+    src/io/CheckpointReader.cpp
+    src/io/CheckpointReader.hpp
+    src/io/CheckpointWriter.cpp
+    src/io/CheckpointWriter.hpp
     src/io/Export.hpp
     src/io/ExportCSV.cpp
     src/io/ExportCSV.hpp
@@ -192,6 +200,8 @@ target_sources(precice
     src/mapping/RadialBasisFctMapping.hpp
     src/mapping/RadialBasisFctSolver.hpp
     src/mapping/SharedPointer.hpp
+    src/mapping/SparseOperator.cpp
+    src/mapping/SparseOperator.hpp
     src/mapping/config/MappingConfiguration.cpp
     src/mapping/config/MappingConfiguration.hpp
     src/mapping/impl/BasisFunctions.hpp
@@ -266,6 +276,7 @@ target_sources(precice
     src/precice/types.hpp
     src/query/Index.cpp
     src/query/Index.hpp
+    src/query/impl/KDTree.hpp
     src/query/impl/RTreeAdapter.hpp
     src/time/SharedPointer.hpp
     src/time/Time.cpp
@@ -296,11 +307,15 @@ target_sources(precice
     src/utils/Petsc.cpp
     src/utils/Petsc.hpp
     src/utils/PointerVector.hpp
+    src/utils/ReductionBatch.cpp
+    src/utils/ReductionBatch.hpp
     src/utils/Statistics.hpp
     src/utils/String.cpp
     src/utils/String.hpp
     src/utils/TableWriter.cpp
     src/utils/TableWriter.hpp
+    src/utils/ThreadPool.cpp
+    src/utils/ThreadPool.hpp
     src/utils/TypeNames.hpp
     src/utils/algorithm.hpp
     src/utils/assertion.hpp
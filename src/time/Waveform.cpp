@@ -1,6 +1,9 @@
 #include "time/Waveform.hpp"
 #include <algorithm>
+#include <utility>
 #include "cplscheme/CouplingScheme.hpp"
+#include "io/CheckpointReader.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "time/Time.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -89,6 +92,28 @@ void Waveform::moveToNextWindow()
   }
 }
 
+void Waveform::exportState(io::CheckpointWriter &writer) const
+{
+  PRECICE_ASSERT(_storageIsInitialized);
+  writer.writeTag("Waveform");
+  writer.write(_numberOfStoredSamples);
+  writer.write(_timeWindowsStorage);
+}
+
+void Waveform::importState(io::CheckpointReader &reader)
+{
+  PRECICE_ASSERT(_storageIsInitialized);
+  reader.readTag("Waveform");
+  Eigen::MatrixXd storage;
+  reader.read(_numberOfStoredSamples);
+  reader.read(storage);
+  PRECICE_CHECK(storage.rows() == _timeWindowsStorage.rows() && storage.cols() == _timeWindowsStorage.cols(),
+                "The waveform in the checkpoint stores {} samples of {} values, but {} samples of {} values are required. "
+                "Please restart with the configuration and the number of ranks of the run, which wrote the checkpoint.",
+                storage.cols(), storage.rows(), _timeWindowsStorage.cols(), _timeWindowsStorage.rows());
+  _timeWindowsStorage = std::move(storage);
+}
+
 int Waveform::maxNumberOfStoredSamples()
 {
   PRECICE_ASSERT(_storageIsInitialized);
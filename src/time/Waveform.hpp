@@ -5,6 +5,11 @@
 
 namespace precice {
 
+namespace io {
+class CheckpointReader;
+class CheckpointWriter;
+} // namespace io
+
 namespace testing {
 // Forward declaration to friend the boost test struct
 class WaveformFixture;
@@ -59,6 +64,12 @@ public:
    */
   void moveToNextWindow();
 
+  /// Writes the stored samples to a checkpoint
+  void exportState(io::CheckpointWriter &writer) const;
+
+  /// Reads the samples written by exportState(), the waveform needs to be initialized with the same size
+  void importState(io::CheckpointReader &reader);
+
   /**
    * @brief Evaluate waveform at specific point in time. Uses interpolation if necessary.
    *
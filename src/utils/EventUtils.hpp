@@ -3,6 +3,7 @@
 #include <chrono>
 #include <iosfwd>
 #include <map>
+#include <mutex>
 #include <stddef.h>
 #include <string>
 #include <utility>
@@ -194,6 +195,9 @@ private:
 
   std::map<std::string, Event> storedEvents;
 
+  /// Serializes storing events, which may be stopped by concurrent tasks
+  std::mutex putMutex;
+
   /// A name that is added to the logfile to distinguish different participants
   std::string applicationName;
 
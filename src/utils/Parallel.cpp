@@ -217,7 +217,9 @@ void Parallel::initializeMPI(
   MPI_Initialized(&isMPIInitialized);
   PRECICE_ASSERT(!isMPIInitialized, "MPI was already initialized.");
   PRECICE_DEBUG("Initialize MPI");
-  MPI_Init(argc, argv);
+  int provided{-1};
+  MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided);
+  PRECICE_DEBUG("MPI provides the thread support level {}", provided);
 #endif // not PRECICE_NO_MPI
 }
 
@@ -251,6 +253,38 @@ void Parallel::finalizeMPI()
 #endif // not PRECICE_NO_MPI
 }
 
+bool Parallel::allowsBackgroundCommunication()
+{
+#ifndef PRECICE_NO_MPI
+  int isMPIInitialized{-1};
+  MPI_Initialized(&isMPIInitialized);
+  if (!isMPIInitialized) {
+    return true;
+  }
+  int provided{-1};
+  MPI_Query_thread(&provided);
+  return provided >= MPI_THREAD_MULTIPLE || (_mpiInitializedByPrecice && provided >= MPI_THREAD_SERIALIZED);
+#else
+  return true;
+#endif // not PRECICE_NO_MPI
+}
+
+bool Parallel::allowsConcurrentCommunication()
+{
+#ifndef PRECICE_NO_MPI
+  int isMPIInitialized{-1};
+  MPI_Initialized(&isMPIInitialized);
+  if (!isMPIInitialized) {
+    return true;
+  }
+  int provided{-1};
+  MPI_Query_thread(&provided);
+  return provided >= MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif // not PRECICE_NO_MPI
+}
+
 void Parallel::registerUserProvidedComm(Communicator comm)
 {
 #ifndef PRECICE_NO_MPI
@@ -148,8 +148,10 @@ public:
   /**
    * @brief Unconditionally initializes the MPI environment.
    *
+   * Requests MPI_THREAD_MULTIPLE, which allows preCICE to communicate from background threads.
+   *
    * @param[in] argc Parameter count
-   * @param[in] argv Parameter values, is passed to MPI_Init
+   * @param[in] argv Parameter values, is passed to MPI_Init_thread
    */
   static void initializeMPI(
       int *   argc,
@@ -171,6 +173,17 @@ public:
   /// Registers a user-provided communicator
   static void registerUserProvidedComm(Communicator comm);
 
+  /**
+   * @brief Checks if preCICE may communicate in a background thread, while the solver continues.
+   *
+   * If preCICE manages MPI, the solver does not use MPI itself and MPI_THREAD_SERIALIZED is sufficient.
+   * Otherwise, the solver may call MPI concurrently, which requires MPI_THREAD_MULTIPLE.
+   */
+  static bool allowsBackgroundCommunication();
+
+  /// Checks if several threads of preCICE may communicate via MPI concurrently, which requires MPI_THREAD_MULTIPLE.
+  static bool allowsConcurrentCommunication();
+
   /// @}
 
   /// @name State-altering Functions
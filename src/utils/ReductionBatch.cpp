@@ -0,0 +1,43 @@
+#include "utils/ReductionBatch.hpp"
+#include <cmath>
+
+#include "utils/IntraComm.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::utils {
+
+ReductionBatch::Index ReductionBatch::add(double localSum)
+{
+  PRECICE_ASSERT(not _isReduced, "Partial sums cannot be added after the reduction.");
+  _localSums.push_back(localSum);
+  return _localSums.size() - 1;
+}
+
+void ReductionBatch::allreduceSum()
+{
+  PRECICE_ASSERT(not _isReduced, "The batch has already been reduced.");
+  _isReduced = true;
+  _globalSums.resize(_localSums.size());
+  if (not _localSums.empty()) {
+    IntraComm::allreduceSum(_localSums, _globalSums);
+  }
+}
+
+double ReductionBatch::get(Index index) const
+{
+  PRECICE_ASSERT(_isReduced, "The batch has not been reduced yet.");
+  PRECICE_ASSERT(index < _globalSums.size(), index, _globalSums.size());
+  return _globalSums[index];
+}
+
+double ReductionBatch::sqrt(Index index) const
+{
+  return std::sqrt(get(index));
+}
+
+std::size_t ReductionBatch::size() const
+{
+  return _localSums.size();
+}
+
+} // namespace precice::utils
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Sums up several local partial sums over all ranks of a participant in a single collective operation.
+ *
+ * Instead of one IntraComm::allreduceSum() per scalar, components add their local partial sums
+ * to the batch and keep the returned index. After allreduceSum(), all ranks can query the
+ * global sums via get(). Without an intra-participant communication, the global sums are the
+ * local ones.
+ *
+ * All ranks have to add the same number of partial sums in the same order.
+ */
+class ReductionBatch {
+public:
+  using Index = std::size_t;
+
+  /// Adds a local partial sum and returns the index of its global sum
+  Index add(double localSum);
+
+  /// Sums up all partial sums over all ranks
+  void allreduceSum();
+
+  /// Returns the global sum of the given index
+  double get(Index index) const;
+
+  /// Returns the square root of the global sum of the given index, e.g., a l2-norm of a distributed vector
+  double sqrt(Index index) const;
+
+  /// Returns the number of partial sums in the batch
+  std::size_t size() const;
+
+private:
+  std::vector<double> _localSums;
+
+  std::vector<double> _globalSums;
+
+  bool _isReduced = false;
+};
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,200 @@
+#include "utils/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::utils {
+
+namespace {
+/// State of a parallelFor(), which is shared with the workers helping to process it
+struct ParallelLoop {
+  std::atomic<std::size_t>           next;
+  std::size_t                        end;
+  std::size_t                        grainSize;
+  const ThreadPool::RangeFunction *  func;
+  std::atomic<std::size_t>           pendingChunks;
+  std::mutex                         mutex;
+  std::condition_variable            done;
+  std::exception_ptr                 exception;
+
+  /// Processes chunks until all chunks have been claimed
+  void process()
+  {
+    while (true) {
+      const std::size_t first = next.fetch_add(grainSize);
+      if (first >= end) {
+        return;
+      }
+      try {
+        (*func)(first, std::min(first + grainSize, end));
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (not exception) {
+          exception = std::current_exception();
+        }
+      }
+      if (pendingChunks.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.notify_all();
+      }
+    }
+  }
+};
+} // namespace
+
+ThreadPool &ThreadPool::instance()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+  stop();
+}
+
+void ThreadPool::configure(int threads, bool pinThreads)
+{
+  PRECICE_ASSERT(threads > 0, threads);
+  stop();
+  if (threads == 1) {
+    PRECICE_DEBUG("Thread pool is disabled");
+    return;
+  }
+
+#ifdef __linux__
+  const int firstCore = sched_getcpu();
+  const int cores     = std::max<int>(std::thread::hardware_concurrency(), 1);
+#else
+  if (pinThreads) {
+    PRECICE_WARN("Pinning threads is only supported on Linux. The threads of preCICE will not be pinned.");
+  }
+#endif
+
+  for (int i = 1; i < threads; ++i) {
+    _workers.emplace_back(&ThreadPool::work, this);
+#ifdef __linux__
+    if (pinThreads && firstCore >= 0) {
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET((firstCore + i) % cores, &cpus);
+      if (pthread_setaffinity_np(_workers.back().native_handle(), sizeof(cpu_set_t), &cpus) != 0) {
+        PRECICE_WARN("Failed to pin a thread of preCICE to core {}.", (firstCore + i) % cores);
+      }
+    }
+#endif
+  }
+  PRECICE_DEBUG("Thread pool started {} workers", _workers.size());
+}
+
+int ThreadPool::threads() const
+{
+  return _workers.size() + 1;
+}
+
+bool ThreadPool::isEnabled() const
+{
+  return not _workers.empty();
+}
+
+std::future<void> ThreadPool::submit(Task task)
+{
+  auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+  auto future   = packaged->get_future();
+  if (isEnabled()) {
+    enqueue([packaged] { (*packaged)(); });
+  } else {
+    (*packaged)();
+  }
+  return future;
+}
+
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const RangeFunction &func)
+{
+  if (begin >= end) {
+    return;
+  }
+  grainSize                = std::max<std::size_t>(grainSize, 1);
+  const std::size_t chunks = (end - begin + grainSize - 1) / grainSize;
+  if (not isEnabled() || chunks == 1) {
+    func(begin, end);
+    return;
+  }
+
+  auto loop           = std::make_shared<ParallelLoop>();
+  loop->next          = begin;
+  loop->end           = end;
+  loop->grainSize     = grainSize;
+  loop->func          = &func;
+  loop->pendingChunks = chunks;
+
+  // Helpers which start after all chunks have been claimed return immediately
+  const std::size_t helpers = std::min(_workers.size(), chunks - 1);
+  for (std::size_t i = 0; i < helpers; ++i) {
+    enqueue([loop] { loop->process(); });
+  }
+  loop->process();
+
+  std::unique_lock<std::mutex> lock(loop->mutex);
+  loop->done.wait(lock, [&loop] { return loop->pendingChunks == 0; });
+  if (loop->exception) {
+    std::rethrow_exception(loop->exception);
+  }
+}
+
+void ThreadPool::enqueue(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.push_back(std::move(task));
+  }
+  _condition.notify_one();
+}
+
+void ThreadPool::work()
+{
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this] { return _stop || not _tasks.empty(); });
+      if (_tasks.empty()) {
+        return;
+      }
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+void ThreadPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _condition.notify_all();
+  for (auto &worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+  _stop = false;
+}
+
+void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const ThreadPool::RangeFunction &func)
+{
+  ThreadPool::instance().parallelFor(begin, end, grainSize, func);
+}
+
+} // namespace precice::utils
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Pool of worker threads for the parallelism within a rank.
+ *
+ * The pool is disabled by default, which executes all work on the calling thread.
+ * configure() starts the workers, such that the calling thread and the workers share the work.
+ *
+ * parallelFor() splits a range into chunks. The calling thread and all idle workers claim the
+ * chunks one after another, which balances uneven work. As the calling thread never waits for
+ * chunks which have not been claimed yet, parallelFor() can be nested in tasks and loops.
+ */
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  /// Processes the items of the range [begin, end)
+  using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+  /// Returns the pool of this process
+  static ThreadPool &instance();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// Stops all workers
+  ~ThreadPool();
+
+  /**
+   * @brief Configures the number of threads, which includes the calling thread.
+   *
+   * A single thread disables the pool. Previously started workers are stopped.
+   *
+   * @param[in] threads Number of threads including the calling thread.
+   * @param[in] pinThreads Pins the workers to the cores following the core of the calling thread.
+   */
+  void configure(int threads, bool pinThreads);
+
+  /// Returns the number of threads including the calling thread
+  int threads() const;
+
+  /// Returns true, if workers have been started
+  bool isEnabled() const;
+
+  /// Executes the task by a worker, or immediately by the calling thread, if the pool is disabled
+  std::future<void> submit(Task task);
+
+  /**
+   * @brief Processes the range [begin, end) in chunks of grainSize items in parallel.
+   *
+   * Returns after all chunks have been processed. Rethrows the first exception thrown by func.
+   */
+  void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const RangeFunction &func);
+
+private:
+  ThreadPool() = default;
+
+  logging::Logger _log{"utils::ThreadPool"};
+
+  std::vector<std::thread> _workers;
+
+  std::deque<Task> _tasks;
+
+  std::mutex _mutex;
+
+  std::condition_variable _condition;
+
+  bool _stop = false;
+
+  void enqueue(Task task);
+
+  void work();
+
+  void stop();
+};
+
+/// Processes the range [begin, end) in chunks of grainSize items using the pool of this process, see ThreadPool::parallelFor()
+void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const ThreadPool::RangeFunction &func);
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,61 @@
+#include <Eigen/Core>
+#include "testing/Testing.hpp"
+#include "utils/ReductionBatch.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+
+BOOST_AUTO_TEST_SUITE(ReductionBatch)
+
+BOOST_AUTO_TEST_CASE(Serial)
+{
+  PRECICE_TEST(""_on(1_rank).setupIntraComm());
+
+  utils::ReductionBatch batch;
+  const auto            first  = batch.add(4.0);
+  const auto            second = batch.add(-1.5);
+  BOOST_TEST(batch.size() == 2);
+  batch.allreduceSum();
+  BOOST_TEST(batch.get(first) == 4.0);
+  BOOST_TEST(batch.get(second) == -1.5);
+  BOOST_TEST(batch.sqrt(first) == 2.0);
+}
+
+BOOST_AUTO_TEST_CASE(Parallel)
+{
+  PRECICE_TEST(""_on(3_ranks).setupIntraComm());
+
+  Eigen::VectorXd v;
+  if (context.isPrimary()) {
+    v.resize(3);
+    v << 1, 2, 3;
+  } else if (context.isRank(1)) {
+    v.resize(2);
+    v << 4, 5;
+  } else {
+    v.resize(0);
+  }
+
+  utils::ReductionBatch batch;
+  const auto            squaredNorm = batch.add(v.squaredNorm());
+  const auto            rank        = batch.add(context.rank);
+  const auto            sum         = batch.add(v.sum());
+  batch.allreduceSum();
+  BOOST_TEST(batch.get(squaredNorm) == 55.0);
+  BOOST_TEST(batch.get(rank) == 3.0);
+  BOOST_TEST(batch.get(sum) == 15.0);
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm());
+
+  utils::ReductionBatch batch;
+  batch.allreduceSum();
+  BOOST_TEST(batch.size() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ReductionBatch
+
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice;
+using precice::utils::ThreadPool;
+
+namespace {
+/// Restores the disabled pool after each test
+struct ThreadPoolFixture {
+  ~ThreadPoolFixture()
+  {
+    ThreadPool::instance().configure(1, false);
+  }
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_FIXTURE_TEST_SUITE(ThreadPoolTests, ThreadPoolFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  BOOST_TEST(!pool.isEnabled());
+  BOOST_TEST(pool.threads() == 1);
+
+  bool executed = false;
+  auto future   = pool.submit([&executed] { executed = true; });
+  BOOST_TEST(executed);
+  future.get();
+
+  std::vector<int> values(100, 0);
+  utils::parallelFor(0, values.size(), 7, [&values](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      values[i] = i;
+    }
+  });
+  BOOST_TEST(std::accumulate(values.begin(), values.end(), 0) == 4950);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelFor)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  pool.configure(4, false);
+  BOOST_TEST(pool.isEnabled());
+  BOOST_TEST(pool.threads() == 4);
+
+  std::vector<int>         values(10000, 0);
+  std::atomic<std::size_t> chunks{0};
+  std::atomic<bool>        tooLarge{false};
+  // Boost.Test is not thread-safe, hence, no checks in the loop
+  pool.parallelFor(10, values.size(), 64, [&](std::size_t begin, std::size_t end) {
+    tooLarge = tooLarge || (end - begin > 64);
+    for (auto i = begin; i < end; ++i) {
+      values[i] += 1;
+    }
+    ++chunks;
+  });
+  BOOST_TEST(!tooLarge);
+  BOOST_TEST(chunks == (values.size() - 10 + 63) / 64);
+  BOOST_TEST(std::accumulate(values.begin(), values.end(), 0) == 9990);
+  BOOST_TEST(std::all_of(values.begin(), values.begin() + 10, [](int v) { return v == 0; }));
+
+  // Empty ranges do nothing
+  bool called = false;
+  pool.parallelFor(5, 5, 1, [&called](std::size_t, std::size_t) { called = true; });
+  BOOST_TEST(!called);
+}
+
+BOOST_AUTO_TEST_CASE(NestedTasks)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  pool.configure(3, false);
+
+  // Tasks using parallel loops themselves must not deadlock
+  std::vector<std::vector<int>>  values(8, std::vector<int>(1000, 1));
+  std::vector<std::future<void>> futures;
+  for (auto &v : values) {
+    futures.push_back(pool.submit([&v] {
+      utils::parallelFor(0, v.size(), 10, [&v](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          v[i] *= 2;
+        }
+      });
+    }));
+  }
+  for (auto &future : futures) {
+    future.get();
+  }
+  for (const auto &v : values) {
+    BOOST_TEST(std::accumulate(v.begin(), v.end(), 0) == 2000);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Exceptions)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  pool.configure(2, false);
+
+  BOOST_CHECK_THROW(pool.parallelFor(0, 100, 1, [](std::size_t begin, std::size_t) {
+    if (begin == 42) {
+      throw std::runtime_error("42");
+    }
+  }),
+                    std::runtime_error);
+  BOOST_CHECK_THROW(pool.submit([] { throw std::runtime_error("task"); }).get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ThreadPoolTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
@@ -0,0 +1,67 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/SolverInterface.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+/**
+ * @brief Moves a vertex of a provided mesh after initialize() and checks that the read mapping is updated.
+ *
+ * SolverOne writes constant data on three vertices. SolverTwo reads the data via a nearest-neighbor mapping
+ * on two vertices and moves one of them after the first time window.
+ */
+BOOST_AUTO_TEST_CASE(MoveMeshVertices)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::SolverInterface interface(context.name, context.config(), 0, 1);
+  if (context.isNamed("SolverOne")) {
+    const auto          meshID = interface.getMeshID("MeshOne");
+    const auto          dataID = interface.getDataID("DataOne", meshID);
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 2.0, 0.0, 0.0};
+    std::vector<int>    ids(3);
+    interface.setMeshVertices(meshID, 3, positions.data(), ids.data());
+    std::vector<double> values{1.0, 2.0, 3.0};
+
+    double dt = interface.initialize();
+    while (interface.isCouplingOngoing()) {
+      interface.writeBlockScalarData(dataID, 3, ids.data(), values.data());
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+  } else {
+    BOOST_TEST(context.isNamed("SolverTwo"));
+    const auto          meshID = interface.getMeshID("MeshTwo");
+    const auto          dataID = interface.getDataID("DataOne", meshID);
+    std::vector<double> positions{0.1, 0.0, 0.0, 1.9, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    interface.setMeshVertices(meshID, 2, positions.data(), ids.data());
+    std::vector<double> values(2);
+
+    double dt = interface.initialize();
+    interface.readBlockScalarData(dataID, 2, ids.data(), values.data());
+    BOOST_TEST(values == std::vector<double>({1.0, 3.0}), boost::test_tools::per_element());
+
+    std::vector<double> newPosition{1.1, 0.0, 0.0};
+    interface.moveMeshVertices(meshID, 1, &ids[0], newPosition.data());
+    std::vector<double> currentPosition(3);
+    interface.getMeshVertices(meshID, 1, &ids[0], currentPosition.data());
+    BOOST_TEST(currentPosition == newPosition, boost::test_tools::per_element());
+
+    dt = interface.advance(dt);
+    interface.readBlockScalarData(dataID, 2, ids.data(), values.data());
+    BOOST_TEST(values == std::vector<double>({2.0, 3.0}), boost::test_tools::per_element());
+
+    interface.advance(dt);
+    BOOST_TEST(!interface.isCouplingOngoing());
+    interface.finalize();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+
+#endif // PRECICE_NO_MPI
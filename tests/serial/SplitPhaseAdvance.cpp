@@ -0,0 +1,55 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/SolverInterface.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+/**
+ * @brief Couples a participant using startAdvance() and completeAdvance() with a participant using advance().
+ *
+ * Both participants write the number of the time window, in which they write, and check the received values.
+ */
+BOOST_AUTO_TEST_CASE(SplitPhaseAdvance)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::SolverInterface interface(context.name, context.config(), 0, 1);
+
+  const bool          isOne     = context.isNamed("SolverOne");
+  const auto          meshID    = interface.getMeshID(isOne ? "MeshOne" : "MeshTwo");
+  const auto          writeID   = interface.getDataID(isOne ? "DataOne" : "DataTwo", meshID);
+  const auto          readID    = interface.getDataID(isOne ? "DataTwo" : "DataOne", meshID);
+  std::vector<double> positions = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+  std::vector<int>    ids(2);
+  interface.setMeshVertices(meshID, 2, positions.data(), ids.data());
+
+  double dt     = interface.initialize();
+  int    window = 0;
+  while (interface.isCouplingOngoing()) {
+    ++window;
+    std::vector<double> values(2, isOne ? window : 10.0 * window);
+    interface.writeBlockScalarData(writeID, 2, ids.data(), values.data());
+
+    if (isOne) {
+      interface.startAdvance(dt);
+      // Work, which does not depend on the coupling data, would be done here.
+      dt = interface.completeAdvance();
+    } else {
+      dt = interface.advance(dt);
+    }
+
+    interface.readBlockScalarData(readID, 2, ids.data(), values.data());
+    const double expected = isOne ? 10.0 * window : window;
+    BOOST_TEST(values == std::vector<double>(2, expected), boost::test_tools::per_element());
+  }
+  BOOST_TEST(window == 3);
+  interface.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+
+#endif // PRECICE_NO_MPI
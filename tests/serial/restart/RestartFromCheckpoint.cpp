@@ -0,0 +1,74 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/SolverInterface.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * Couples both participants starting after the given time window and returns the last time window.
+ *
+ * Both participants write the number of the time window, in which they write, and check the received values.
+ * After a restart, the values received in the last time window before the checkpoint have to be readable before the first advance.
+ */
+int runWindows(const precice::testing::TestContext &context, const std::string &config, int window)
+{
+  const bool isOne    = context.isNamed("SolverOne");
+  auto       expected = [isOne](int window) {
+    return std::vector<double>(2, isOne ? 10.0 * window : window);
+  };
+
+  precice::SolverInterface interface(context.name, config, 0, 1);
+  const auto               meshID    = interface.getMeshID(isOne ? "MeshOne" : "MeshTwo");
+  const auto               writeID   = interface.getDataID(isOne ? "DataOne" : "DataTwo", meshID);
+  const auto               readID    = interface.getDataID(isOne ? "DataTwo" : "DataOne", meshID);
+  std::vector<double>      positions = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+  std::vector<int>         ids(2);
+  std::vector<double>      values(2);
+  interface.setMeshVertices(meshID, 2, positions.data(), ids.data());
+
+  double dt = interface.initialize();
+  if (window > 0) {
+    interface.readBlockScalarData(readID, 2, ids.data(), values.data());
+    BOOST_TEST(values == expected(window), boost::test_tools::per_element());
+  }
+  while (interface.isCouplingOngoing()) {
+    ++window;
+    values.assign(2, isOne ? window : 10.0 * window);
+    interface.writeBlockScalarData(writeID, 2, ids.data(), values.data());
+    dt = interface.advance(dt);
+    interface.readBlockScalarData(readID, 2, ids.data(), values.data());
+    BOOST_TEST(values == expected(window), boost::test_tools::per_element());
+  }
+  interface.finalize();
+  return window;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(Restart)
+
+/// Runs three time windows and writes a checkpoint after the second one.
+BOOST_AUTO_TEST_CASE(WriteCheckpoint)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  BOOST_TEST(runWindows(context, context.prefix("WriteCheckpoint.xml"), 0) == 3);
+}
+
+/// Restarts from the checkpoint after the second time window and runs until the fourth one.
+BOOST_AUTO_TEST_CASE(RestartFromCheckpoint, *boost::unit_test::depends_on("Integration/Serial/Restart/WriteCheckpoint"))
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  BOOST_TEST(runWindows(context, context.config(), 2) == 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Restart
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
@@ -59,8 +59,10 @@ target_sources(testprecice
     tests/parallel/quasi-newton/helpers.cpp
     tests/parallel/quasi-newton/helpers.hpp
     tests/serial/AitkenAcceleration.cpp
+    tests/serial/MoveMeshVertices.cpp
     tests/serial/PreconditionerBug.cpp
     tests/serial/SendMeshToMultipleParticipants.cpp
+    tests/serial/SplitPhaseAdvance.cpp
     tests/serial/SummationActionTwoSources.cpp
     tests/serial/TestExplicitWithDataMultipleReadWrite.cpp
     tests/serial/TestExplicitWithSolverGeometry.cpp
@@ -146,6 +148,7 @@ target_sources(testprecice
     tests/serial/multiple-mappings/MultipleWriteFromMappings.cpp
     tests/serial/multiple-mappings/MultipleWriteFromMappingsAndData.cpp
     tests/serial/multiple-mappings/MultipleWriteToMappings.cpp
+    tests/serial/restart/RestartFromCheckpoint.cpp
     tests/serial/stationary-mapping-with-solver-mesh/StationaryMappingWithSolverMesh2D.cpp
     tests/serial/stationary-mapping-with-solver-mesh/StationaryMappingWithSolverMesh3D.cpp
     tests/serial/stationary-mapping-with-solver-mesh/helpers.cpp
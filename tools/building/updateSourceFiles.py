@@ -38,8 +38,9 @@ def get_cmake_file_paths(root):
     sources = os.path.join(root, "src", "sources.cmake")
     utests = os.path.join(root, "src", "tests.cmake")
     itests = os.path.join(root, "tests", "tests.cmake")
-    cmakepaths = collections.namedtuple("CMakePaths", "sources utests itests")
-    return cmakepaths(sources, utests, itests)
+    benchmarks = os.path.join(root, "benchmarks", "benchmarks.cmake")
+    cmakepaths = collections.namedtuple("CMakePaths", "sources utests itests benchmarks")
+    return cmakepaths(sources, utests, itests, benchmarks)
 
 
 def is_precice_root(root):
@@ -84,7 +85,19 @@ def get_file_lists(root):
         ]
         itests += files
 
-    return sorted(sources), sorted(public), sorted(utests), sorted(itests)
+    benchmarks_dir = os.path.join(root, "benchmarks")
+    benchmarks = []
+    for dir, _, filenames in os.walk(benchmarks_dir):
+        files = [
+            os.path.relpath(os.path.join(dir, name), root)
+            for name in filenames
+            if file_extension(name) in exts
+        ]
+        benchmarks += files
+    # The main file is added to the target directly
+    benchmarks.remove(os.path.join("benchmarks", "main.cpp"))
+
+    return sorted(sources), sorted(public), sorted(utests), sorted(itests), sorted(benchmarks)
 
 
 def itest_path_to_suite(path):
@@ -136,6 +149,14 @@ target_sources(testprecice
 # Contains the list of integration test suites
 set(PRECICE_TEST_SUITES {})
 """
+BENCHMARKS_BASE = """#
+# This file lists all benchmark sources that will be compiled into the benchmark executable
+#
+target_sources(precice-bench
+    PRIVATE
+    {}
+    )
+"""
 
 
 def generate_lib_sources(sources, public):
@@ -158,18 +179,24 @@ def generate_integration_tests(itests):
     )
 
 
+def generate_benchmarks(benchmarks):
+    return BENCHMARKS_BASE.format(
+        "\n    ".join(benchmarks)
+    )
+
+
 def main():
     root = os.curdir
     if not is_precice_root(root):
         print("Current dir {} is not the root of the precice repository!".format(root))
         return 1
-    sources, public, utests, itests = get_file_lists(root)
-    print("Detected files:\n  sources: {}\n  public headers: {}\n  unit tests: {}\n  integration tests: {}".format(len(sources), len(public), len(utests), len(itests)))
+    sources, public, utests, itests, benchmarks = get_file_lists(root)
+    print("Detected files:\n  sources: {}\n  public headers: {}\n  unit tests: {}\n  integration tests: {}\n  benchmarks: {}".format(len(sources), len(public), len(utests), len(itests), len(benchmarks)))
 
     gitfiles = get_gitfiles()
     if gitfiles:
         not_tracked = list(
-            set(sources + public + utests + itests) - set(gitfiles + CONFIGURED_SOURCES + CONFIGURED_PUBLIC)
+            set(sources + public + utests + itests + benchmarks) - set(gitfiles + CONFIGURED_SOURCES + CONFIGURED_PUBLIC)
         )
         if not_tracked:
             print("The source tree contains files not tracked by git.")
@@ -193,6 +220,7 @@ def main():
     sources_content = generate_lib_sources(sources, public)
     utests_content = generate_unit_tests(utests)
     itests_content = generate_integration_tests(itests)
+    benchmarks_content = generate_benchmarks(benchmarks)
 
     print("Writing Files")
     print(" {}".format(files.sources))
@@ -207,6 +235,10 @@ def main():
     with open(files.itests, "w") as f:
         f.write(itests_content)
 
+    print(" {}".format(files.benchmarks))
+    with open(files.benchmarks, "w") as f:
+        f.write(benchmarks_content)
+
     print("done")
     return 0
 